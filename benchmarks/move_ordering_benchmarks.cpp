@@ -0,0 +1,115 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helper_functions.hpp"
+#include "bitboard_enums.hpp"
+#include "board_state.hpp"
+#include "fen_formatter.hpp"
+#include "heuristics/move_ordering/quiet_move_history.hpp"
+#include "heuristics/move_ordering/score_moves.hpp"
+#include "legal_move_generators/legal_moves_generator.hpp"
+#include "move_sink.hpp"
+#include "restriction_context.hpp"
+#include "search_config.hpp"
+#include <algorithm>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+constexpr std::string_view KIWIPETE_PATH = "../data/fens/kiwipete.fen";
+
+// Moves tried before the node is left: a cut node often stops after the first one.
+constexpr int FIRST_MOVE_ONLY = 1;
+constexpr int FEW_MOVES       = 4;
+constexpr int ALL_MOVES       = bitcrusher::MAX_LEGAL_MOVES;
+
+// The full selection sort the main search ran before trying the first move.
+void sortAllMoves(bitcrusher::FastMoveSink& sink, int ply) {
+    auto&     moves  = sink.moves[ply];
+    auto&     scores = sink.scores[ply];
+    const int count  = sink.count[ply];
+    for (int i = 0; i < count - 1; ++i) {
+        int best_idx = i;
+        for (int j = i + 1; j < count; ++j) {
+            if (scores[j] > scores[best_idx])
+                best_idx = j;
+        }
+        std::swap(moves[i], moves[best_idx]);
+        std::swap(scores[i], scores[best_idx]);
+    }
+}
+
+} // namespace
+
+using bench::utils::loadFENFromFile;
+
+class MoveOrderingBenchmarksFixture : public benchmark::Fixture {
+public:
+    // Scored kiwipete moves, copied into the sink before every ordering run.
+    std::unique_ptr<bitcrusher::FastMoveSink> scored = std::make_unique<bitcrusher::FastMoveSink>();
+    std::unique_ptr<bitcrusher::FastMoveSink> sink   = std::make_unique<bitcrusher::FastMoveSink>();
+
+    MoveOrderingBenchmarksFixture() {
+        bitcrusher::BoardState         board;
+        bitcrusher::RestrictionContext restriction_context;
+        bitcrusher::parseFEN(loadFENFromFile(KIWIPETE_PATH), board);
+        bitcrusher::generateLegalMoves<bitcrusher::Color::WHITE,
+                                       bitcrusher::MoveGenerationPolicy::COMPETITIVE_FULL>(
+            board, *scored, restriction_context);
+
+        // History varies by move so the quiet moves are not all tied.
+        bitcrusher::heuristics::QuietMoveHistory history;
+        for (int i = 0; i < scored->count[0]; ++i) {
+            history.butterfly.update<bitcrusher::Color::WHITE>(scored->moves[0][i],
+                                                               ((i * 37) % 200) - 100);
+        }
+        for (int i = 0; i < scored->count[0]; ++i) {
+            const bitcrusher::Move& move = scored->moves[0][i];
+            scored->scores[0][i] =
+                move.isCapture()
+                    ? bitcrusher::heuristics::scoreCapture<bitcrusher::DEFAULT_CONFIG>(move)
+                    : bitcrusher::heuristics::scoreQuiet<bitcrusher::DEFAULT_CONFIG,
+                                                         bitcrusher::Color::WHITE>(
+                          move, history, 0, bitcrusher::Move::none());
+        }
+    }
+
+    void resetMoves() {
+        sink->moves[0]  = scored->moves[0];
+        sink->scores[0] = scored->scores[0];
+        sink->count[0]  = scored->count[0];
+    }
+};
+
+// Baseline: sort every move, then take the first state.range(0) of them.
+BENCHMARK_DEFINE_F(MoveOrderingBenchmarksFixture, SortAllMoves)(benchmark::State& state) {
+    const int tried_moves = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        resetMoves();
+        sortAllMoves(*sink, 0);
+        for (int i = 0; i < std::min(tried_moves, sink->count[0]); ++i) {
+            benchmark::DoNotOptimize(sink->moves[0][i]);
+        }
+    }
+}
+
+// Pick the best remaining move each time one is needed.
+BENCHMARK_DEFINE_F(MoveOrderingBenchmarksFixture, PickBestMove)(benchmark::State& state) {
+    const int tried_moves = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        resetMoves();
+        for (int i = 0; i < std::min(tried_moves, sink->count[0]); ++i) {
+            bitcrusher::heuristics::pickBest(*sink, 0, i, sink->count[0]);
+            benchmark::DoNotOptimize(sink->moves[0][i]);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(MoveOrderingBenchmarksFixture, SortAllMoves)
+    ->Arg(FIRST_MOVE_ONLY)
+    ->Arg(FEW_MOVES)
+    ->Arg(ALL_MOVES);
+BENCHMARK_REGISTER_F(MoveOrderingBenchmarksFixture, PickBestMove)
+    ->Arg(FIRST_MOVE_ONLY)
+    ->Arg(FEW_MOVES)
+    ->Arg(ALL_MOVES);
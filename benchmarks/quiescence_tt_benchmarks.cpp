@@ -0,0 +1,123 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helper_functions.hpp"
+#include "fen_formatter.hpp"
+#include "move_processor.hpp"
+#include "move_sink.hpp"
+#include "search.hpp"
+#include "search_config.hpp"
+#include "zobrist_hash_keys.hpp"
+#include <cstdint>
+#include <memory>
+#include <stop_token>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr std::string_view BRATKO_KOPEC_PATH      = "../data/epd/Bratko_Kopec.epd";
+constexpr std::string_view SILENT_BUT_DEADLY_PATH = "../data/epd/Silent_but_deadly.epd";
+constexpr std::string_view ERET_PATH              = "../data/epd/Eigenmann_Rapid_Engine_Test.epd";
+
+// Iterative deepening depth in plies for every position of a suite.
+constexpr int SEARCH_DEPTH = 4;
+
+// DEFAULT_CONFIG with the quiescence transposition table turned off, the baseline.
+constexpr bitcrusher::SearchConfig NO_QUIESCENCE_TT_CONFIG{
+    .tt_move_ordering = {.enabled = true},
+    .mvv_lva          = {.enabled = true},
+    .quiescence       = {.enabled = true, .use_transposition_table = false},
+};
+
+} // namespace
+
+using bench::utils::Epd;
+using bench::utils::loadEPDsFromFile;
+
+// Searches every position to SEARCH_DEPTH with iterative deepening and returns the total node
+// count. The table is cleared between positions so each one starts cold.
+template <bitcrusher::SearchConfig Config>
+static uint64_t searchSuite(const std::vector<Epd>& suite, bitcrusher::SharedSearchContext& ctx) {
+    uint64_t                           nodes = 0;
+    bitcrusher::FastMoveSink           sink;
+    bitcrusher::RestrictionContext     restriction_context;
+    const bitcrusher::SearchParameters params;
+    std::stop_token                    st;
+
+    auto thread_ctx = std::make_unique<bitcrusher::ThreadSearchContext>();
+    for (const Epd& epd : suite) {
+        bitcrusher::BoardState board;
+        bitcrusher::parseFEN(epd.fen, board);
+        bitcrusher::MoveProcessor move_processor;
+        ctx.tt.clear();
+        ctx.nodes_searched.reset();
+        for (int depth = 1; depth <= SEARCH_DEPTH; ++depth) {
+            ctx.tt.newSearch();
+            if (board.isWhiteMove()) {
+                bitcrusher::search<bitcrusher::Color::WHITE, Config, true>(
+                    ctx, *thread_ctx, board, move_processor, params, restriction_context, depth,
+                    -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+            } else {
+                bitcrusher::search<bitcrusher::Color::BLACK, Config, true>(
+                    ctx, *thread_ctx, board, move_processor, params, restriction_context, depth,
+                    -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+            }
+        }
+        nodes += ctx.nodes_searched.total();
+    }
+    return nodes;
+}
+
+class QuiescenceTTFixture : public benchmark::Fixture {
+public:
+    std::vector<Epd> bratko_kopec_epds      = loadEPDsFromFile(BRATKO_KOPEC_PATH);
+    std::vector<Epd> silent_but_deadly_epds = loadEPDsFromFile(SILENT_BUT_DEADLY_PATH);
+    std::vector<Epd> eret_epds              = loadEPDsFromFile(ERET_PATH);
+    // Heap allocated, the context holds the whole transposition table.
+    std::unique_ptr<bitcrusher::SharedSearchContext> ctx =
+        std::make_unique<bitcrusher::SharedSearchContext>();
+
+    QuiescenceTTFixture() { bitcrusher::ZobristKeys::init(bitcrusher::ZOBRIST_SEED); }
+
+    // Runs a suite with and without the quiescence TT. Reports:
+    //   Nodes_NoQsTT — total nodes without the table in quiescence
+    //   Nodes_QsTT   — total nodes with probing, storing and TT move ordering in quiescence
+    //   Reduction_%  — (1 - Nodes_QsTT / Nodes_NoQsTT) * 100
+    void runSuite(benchmark::State& state, const std::vector<Epd>& suite) {
+        uint64_t nodes_without = 0;
+        uint64_t nodes_with    = 0;
+        for (auto _ : state) {
+            nodes_without = searchSuite<NO_QUIESCENCE_TT_CONFIG>(suite, *ctx);
+            nodes_with    = searchSuite<bitcrusher::DEFAULT_CONFIG>(suite, *ctx);
+            benchmark::DoNotOptimize(nodes_without);
+            benchmark::DoNotOptimize(nodes_with);
+        }
+
+        state.counters["Nodes_NoQsTT"] = static_cast<double>(nodes_without);
+        state.counters["Nodes_QsTT"]   = static_cast<double>(nodes_with);
+        state.counters["Reduction_%"] =
+            (1.0 - (static_cast<double>(nodes_with) / static_cast<double>(nodes_without))) * 100.0;
+    }
+};
+
+BENCHMARK_DEFINE_F(QuiescenceTTFixture, QuiescenceTT_BratkoKopec)(benchmark::State& state) {
+    runSuite(state, bratko_kopec_epds);
+}
+
+BENCHMARK_DEFINE_F(QuiescenceTTFixture, QuiescenceTT_SilentButDeadly)(benchmark::State& state) {
+    runSuite(state, silent_but_deadly_epds);
+}
+
+BENCHMARK_DEFINE_F(QuiescenceTTFixture, QuiescenceTT_ERET)(benchmark::State& state) {
+    runSuite(state, eret_epds);
+}
+
+// One iteration is already a full suite search per configuration.
+BENCHMARK_REGISTER_F(QuiescenceTTFixture, QuiescenceTT_BratkoKopec)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(QuiescenceTTFixture, QuiescenceTT_SilentButDeadly)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(QuiescenceTTFixture, QuiescenceTT_ERET)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
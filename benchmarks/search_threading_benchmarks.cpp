@@ -43,11 +43,18 @@ public:
     }
 };
 
-// Runs a timed search on the given FEN with num_threads and returns nodes/second.
-static double timedSearch(const std::string& fen, int num_threads) {
+struct TimedSearchResult {
+    double nps;
+    int    depth; // Deepest iteration the main thread completed.
+};
+
+// Runs a timed search on the given FEN with num_threads.
+static TimedSearchResult timedSearch(const std::string& fen, int num_threads) {
     bitcrusher::SearchManager manager;
     manager.setMaxCores(num_threads);
     manager.setPos(fen);
+    int depth = 0;
+    manager.setOnDepthCompleted([&depth](int completed_depth) { depth = completed_depth; });
     bitcrusher::SearchParameters params;
     params.move_time_ms = SEARCH_TIME_MS;
 
@@ -57,7 +64,7 @@ static double timedSearch(const std::string& fen, int num_threads) {
     const double elapsed_s =
         std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
 
-    return static_cast<double>(manager.getNodeCount()) / elapsed_s;
+    return {static_cast<double>(manager.getNodeCount()) / elapsed_s, depth};
 }
 
 // For each thread count N, runs a 1-thread baseline and an N-thread search back-to-back.
@@ -66,26 +73,33 @@ static double timedSearch(const std::string& fen, int num_threads) {
 //   NPS_NT       — nodes/second with N threads
 //   Speedup      — NPS_NT / NPS_1T  (e.g. 1.84 means 84% faster)
 //   Efficiency   — Speedup / N * 100%  (e.g. 92% means each extra thread is 92% productive)
+//   Depth_1T     — depth the 1-thread search completed in the same time
+//   Depth_NT     — depth the N-thread search completed; more nodes only help if this grows
 //
 // All timing is done with std::chrono; the benchmark loop runs entirely under PauseTiming.
 // state.range(0) = N (number of threads for the N-thread run).
 BENCHMARK_DEFINE_F(SearchThreadingFixture, Threading_InitialPosition)(benchmark::State& state) {
     const int n = static_cast<int>(state.range(0));
 
-    double sum_nps_1t = 0.0;
-    double sum_nps_nt = 0.0;
-    int    count      = 0;
+    double sum_nps_1t   = 0.0;
+    double sum_nps_nt   = 0.0;
+    double sum_depth_1t = 0.0;
+    double sum_depth_nt = 0.0;
+    int    count        = 0;
 
     for (auto _ : state) {
-        const double nps_1t = timedSearch(initial_position_fen, 1);
+        const TimedSearchResult result_1t = timedSearch(initial_position_fen, 1);
         // For n=1, reuse the baseline to avoid a redundant search and a nonsensical
         // self-comparison.
-        const double nps_nt = (n == 1) ? nps_1t : timedSearch(initial_position_fen, n);
-        sum_nps_1t += nps_1t;
-        sum_nps_nt += nps_nt;
+        const TimedSearchResult result_nt =
+            (n == 1) ? result_1t : timedSearch(initial_position_fen, n);
+        sum_nps_1t += result_1t.nps;
+        sum_nps_nt += result_nt.nps;
+        sum_depth_1t += result_1t.depth;
+        sum_depth_nt += result_nt.depth;
         ++count;
-        benchmark::DoNotOptimize(nps_1t);
-        benchmark::DoNotOptimize(nps_nt);
+        benchmark::DoNotOptimize(result_1t);
+        benchmark::DoNotOptimize(result_nt);
     }
 
     const double avg_1t     = sum_nps_1t / count;
@@ -99,24 +113,30 @@ BENCHMARK_DEFINE_F(SearchThreadingFixture, Threading_InitialPosition)(benchmark:
                                                         benchmark::Counter::OneK::kIs1000);
     state.counters["Speedup"]      = speedup;
     state.counters["Efficiency_%"] = efficiency;
+    state.counters["Depth_1T"]     = sum_depth_1t / count;
+    state.counters["Depth_NT"]     = sum_depth_nt / count;
 }
 
 // Same as Threading_InitialPosition but for kiwipete (complex middlegame, high branching factor).
 BENCHMARK_DEFINE_F(SearchThreadingFixture, Threading_Kiwipete)(benchmark::State& state) {
     const int n = static_cast<int>(state.range(0));
 
-    double sum_nps_1t = 0.0;
-    double sum_nps_nt = 0.0;
-    int    count      = 0;
+    double sum_nps_1t   = 0.0;
+    double sum_nps_nt   = 0.0;
+    double sum_depth_1t = 0.0;
+    double sum_depth_nt = 0.0;
+    int    count        = 0;
 
     for (auto _ : state) {
-        const double nps_1t = timedSearch(kiwipete_fen, 1);
-        const double nps_nt = (n == 1) ? nps_1t : timedSearch(kiwipete_fen, n);
-        sum_nps_1t += nps_1t;
-        sum_nps_nt += nps_nt;
+        const TimedSearchResult result_1t = timedSearch(kiwipete_fen, 1);
+        const TimedSearchResult result_nt = (n == 1) ? result_1t : timedSearch(kiwipete_fen, n);
+        sum_nps_1t += result_1t.nps;
+        sum_nps_nt += result_nt.nps;
+        sum_depth_1t += result_1t.depth;
+        sum_depth_nt += result_nt.depth;
         ++count;
-        benchmark::DoNotOptimize(nps_1t);
-        benchmark::DoNotOptimize(nps_nt);
+        benchmark::DoNotOptimize(result_1t);
+        benchmark::DoNotOptimize(result_nt);
     }
 
     const double avg_1t     = sum_nps_1t / count;
@@ -130,6 +150,8 @@ BENCHMARK_DEFINE_F(SearchThreadingFixture, Threading_Kiwipete)(benchmark::State&
                                                         benchmark::Counter::OneK::kIs1000);
     state.counters["Speedup"]      = speedup;
     state.counters["Efficiency_%"] = efficiency;
+    state.counters["Depth_1T"]     = sum_depth_1t / count;
+    state.counters["Depth_NT"]     = sum_depth_nt / count;
 }
 
 BENCHMARK_REGISTER_F(SearchThreadingFixture, Threading_InitialPosition)
@@ -0,0 +1,125 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helper_functions.hpp"
+#include "search_manager.hpp"
+#include "split_point.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::string_view BRATKO_KOPEC_PATH      = "../data/epd/Bratko_Kopec.epd";
+constexpr std::string_view SILENT_BUT_DEADLY_PATH = "../data/epd/Silent_but_deadly.epd";
+constexpr std::string_view ERET_PATH              = "../data/epd/Eigenmann_Rapid_Engine_Test.epd";
+
+// Depth in plies every position of a suite is searched to.
+constexpr int SEARCH_DEPTH = 8;
+
+// Cap the maximum thread count tested even on high-core-count machines.
+constexpr int MAX_BENCHMARK_THREADS = 8;
+
+constexpr int LAZY_SMP = static_cast<int>(bitcrusher::ParallelSearchMode::LAZY_SMP);
+constexpr int YBWC     = static_cast<int>(bitcrusher::ParallelSearchMode::YBWC);
+
+} // namespace
+
+using bench::utils::Epd;
+using bench::utils::loadEPDsFromFile;
+
+// Every thread count as {threads, mode} for both parallel search modes.
+static void registerThreadAndModeArgs(benchmark::internal::Benchmark* b) {
+    const int hw    = static_cast<int>(std::thread::hardware_concurrency());
+    const int max_t = std::min(hw > 0 ? hw : 4, MAX_BENCHMARK_THREADS);
+    for (const int mode : {LAZY_SMP, YBWC}) {
+        for (int t = 1; t <= max_t; t *= 2) {
+            b->Args({t, mode});
+        }
+        if ((max_t & (max_t - 1)) != 0) {
+            b->Args({max_t, mode});
+        }
+    }
+}
+
+// Searches every position of the suite to SEARCH_DEPTH from an empty table and returns the
+// wall time in seconds.
+static double timeToDepth(const std::vector<Epd>&        suite,
+                          int                            num_threads,
+                          bitcrusher::ParallelSearchMode mode) {
+    bitcrusher::SearchManager manager;
+    manager.setMaxCores(num_threads);
+    manager.setParallelSearchMode(mode);
+    bitcrusher::SearchParameters params;
+    params.max_ply = SEARCH_DEPTH;
+
+    double seconds = 0.0;
+    for (const Epd& epd : suite) {
+        manager.newGame();
+        manager.setPos(epd.fen);
+        auto t0 = std::chrono::steady_clock::now();
+        manager.startSearch<bitcrusher::FastMoveSink>(params);
+        manager.waitUntilSearchFinished();
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+    return seconds;
+}
+
+class TimeToDepthFixture : public benchmark::Fixture {
+public:
+    std::vector<Epd> bratko_kopec_epds      = loadEPDsFromFile(BRATKO_KOPEC_PATH);
+    std::vector<Epd> silent_but_deadly_epds = loadEPDsFromFile(SILENT_BUT_DEADLY_PATH);
+    std::vector<Epd> eret_epds              = loadEPDsFromFile(ERET_PATH);
+
+    // Searches the suite with 1 thread and with state.range(0) threads in the parallel search
+    // mode state.range(1) (0 = Lazy SMP, 1 = YBWC). Reports:
+    //   Seconds_1T   — time for the whole suite with 1 thread
+    //   Seconds_NT   — time for the whole suite with N threads
+    //   Speedup      — Seconds_1T / Seconds_NT, the time-to-depth speedup
+    //   Efficiency_% — Speedup / N * 100%
+    static void runSuite(benchmark::State& state, const std::vector<Epd>& suite) {
+        const int  n    = static_cast<int>(state.range(0));
+        const auto mode = static_cast<bitcrusher::ParallelSearchMode>(state.range(1));
+
+        double seconds_1t = 0.0;
+        double seconds_nt = 0.0;
+        for (auto _ : state) {
+            seconds_1t = timeToDepth(suite, 1, mode);
+            seconds_nt = (n == 1) ? seconds_1t : timeToDepth(suite, n, mode);
+            benchmark::DoNotOptimize(seconds_1t);
+            benchmark::DoNotOptimize(seconds_nt);
+        }
+
+        const double speedup           = seconds_1t / seconds_nt;
+        state.counters["Seconds_1T"]   = seconds_1t;
+        state.counters["Seconds_NT"]   = seconds_nt;
+        state.counters["Speedup"]      = speedup;
+        state.counters["Efficiency_%"] = speedup / n * 100.0;
+    }
+};
+
+BENCHMARK_DEFINE_F(TimeToDepthFixture, TimeToDepth_BratkoKopec)(benchmark::State& state) {
+    runSuite(state, bratko_kopec_epds);
+}
+
+BENCHMARK_DEFINE_F(TimeToDepthFixture, TimeToDepth_SilentButDeadly)(benchmark::State& state) {
+    runSuite(state, silent_but_deadly_epds);
+}
+
+BENCHMARK_DEFINE_F(TimeToDepthFixture, TimeToDepth_ERET)(benchmark::State& state) {
+    runSuite(state, eret_epds);
+}
+
+// One iteration is already a full suite search per thread count.
+BENCHMARK_REGISTER_F(TimeToDepthFixture, TimeToDepth_BratkoKopec)
+    ->Apply(registerThreadAndModeArgs)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TimeToDepthFixture, TimeToDepth_SilentButDeadly)
+    ->Apply(registerThreadAndModeArgs)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TimeToDepthFixture, TimeToDepth_ERET)
+    ->Apply(registerThreadAndModeArgs)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
@@ -1,11 +1,13 @@
 #ifndef BITCRUSHER_SQUARES_ATTACKED_HPP
 #define BITCRUSHER_SQUARES_ATTACKED_HPP
 
+#include "bitboard_conversions.hpp"
 #include "bitboard_enums.hpp"
 #include "bitboard_utils.hpp"
 #include "board_state.hpp"
 #include "diagonal_slider_attacks.hpp"
 #include "horizontal_vertical_slider_attacks.hpp"
+#include "king_attacks.hpp"
 #include "knight_attacks.hpp"
 #include "pawn_attacks.hpp"
 #include "pext_bitboards.hpp"
@@ -68,6 +70,44 @@ inline std::uint64_t generateSquaresAttackedXRayingOpponentKing(const BoardState
     return attacked_squares;
 }
 
+// Sliders of both colours attacking the square through the given occupancy.
+inline std::uint64_t
+generateSliderAttackersTo(const BoardState& board, Square square, uint64_t occupancy) {
+    const uint64_t diagonal_sliders = board.getDiagonalSliders<Color::WHITE>() |
+                                      board.getDiagonalSliders<Color::BLACK>();
+    const uint64_t hv_sliders       = board.getHorizontalVerticalSliders<Color::WHITE>() |
+                                      board.getHorizontalVerticalSliders<Color::BLACK>();
+#if defined(HAS_BMI2)
+    return (getDiagonalAttacks(square, occupancy) & diagonal_sliders) |
+           (getHorizontalVerticalAttacks(square, occupancy) & hv_sliders);
+#else
+    const uint64_t square_bitboard = convert::toBitboard(square);
+    return (generateDiagonalAttacks(square_bitboard, occupancy) & diagonal_sliders) |
+           (generateHorizontalVerticalAttacks(square_bitboard, occupancy) & hv_sliders);
+#endif
+}
+
+// Pieces of both colours attacking the square, limited to the given occupancy. Removing an
+// attacker from the occupancy and calling this again uncovers the sliders behind it (x-rays).
+inline std::uint64_t
+generateAttackersTo(const BoardState& board, Square square, uint64_t occupancy) {
+    const uint64_t square_bitboard = convert::toBitboard(square);
+    const uint64_t knights         = board.getBitboard<PieceType::KNIGHT, Color::WHITE>() |
+                                     board.getBitboard<PieceType::KNIGHT, Color::BLACK>();
+    const uint64_t kings           = board.getBitboard<PieceType::KING, Color::WHITE>() |
+                                     board.getBitboard<PieceType::KING, Color::BLACK>();
+
+    // A pawn attacks the square if a pawn of the other colour on the square would attack it.
+    uint64_t attackers = (generatePawnsAttacks<Color::BLACK>(square_bitboard) &
+                          board.getBitboard<PieceType::PAWN, Color::WHITE>()) |
+                         (generatePawnsAttacks<Color::WHITE>(square_bitboard) &
+                          board.getBitboard<PieceType::PAWN, Color::BLACK>());
+    attackers |= generateKnightAttacks(square) & knights;
+    attackers |= generateKingAttacks(square) & kings;
+    attackers |= generateSliderAttackersTo(board, square, occupancy);
+    return attackers & occupancy;
+}
+
 } // namespace bitcrusher
 
 #endif // BITCRUSHER_SQUARES_ATTACKED_HPP
\ No newline at end of file
@@ -9,12 +9,17 @@
 
 namespace bitcrusher {
 
+// Seed the engine initialises its keys with. Hashes, and so saved transposition tables, are only
+// comparable between runs using the same seed.
+inline constexpr uint64_t ZOBRIST_SEED = 12345;
+
 class ZobristKeys {
     inline static std::array<std::array<uint64_t, PIECE_COUNT>, SQUARE_COUNT> zobrist_piece_table;
     inline static uint64_t                                                    is_black_move_zobrist;
     inline static std::array<uint64_t, CASTLING_RIGHTS_COUNT> zobrist_castling_rights;
     inline static std::array<uint64_t, BOARD_DIMENSION>       zobrist_en_passant_file;
     inline static bool                                        initialized = false;
+    inline static uint64_t                                    initialized_seed{0};
 
 public:
     static void init(uint64_t seed) {
@@ -22,7 +27,8 @@ public:
             return;
         }
 
-        initialized = true;
+        initialized      = true;
+        initialized_seed = seed;
         std::mt19937_64 rng(seed);
         for (int i = 0; i < SQUARE_COUNT; i++) {
             for (int j = 0; j < PIECE_COUNT; j++) {
@@ -38,6 +44,9 @@ public:
         }
     }
 
+    // Seed of the first init() call, later calls are ignored.
+    static uint64_t getSeed() { return initialized_seed; }
+
     static constexpr uint64_t getPieceSquareKey(Piece piece, Square square) {
         return zobrist_piece_table[static_cast<int>(square)][static_cast<int>(piece)];
     }
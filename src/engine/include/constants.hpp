@@ -5,6 +5,9 @@ namespace bitcrusher {
 
 const int MAX_DEPTH = 500;
 
+inline constexpr int CHECKMATE_BASE      = 1000000;
+inline constexpr int CHECKMATE_THRESHOLD = CHECKMATE_BASE - 1000;
+
 } // namespace bitcrusher
 
 #endif // BITCRUSHER_CONSTANTS_HPP
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef BITCRUSHER_HEURISTICS_EXTENSIONS_HPP
+#define BITCRUSHER_HEURISTICS_EXTENSIONS_HPP
+
+#include "constants.hpp"
+#include "move.hpp"
+#include "transposition_table.hpp"
+#include <cstdlib>
+
+namespace bitcrusher::heuristics {
+
+// Plies a single line may be extended by in total, so repeated checks cannot grow a line without
+// bound. A singular extension extends most of the remaining tree, so it is only tried on lines
+// extended less than MAX_SINGULAR_LINE_EXTENSIONS times.
+inline constexpr int MAX_LINE_EXTENSIONS          = 16;
+inline constexpr int MAX_SINGULAR_LINE_EXTENSIONS = 2;
+
+// Singular extensions: a TT move whose stored lower bound no other move gets near, in a search
+// of the remaining moves at about half the depth, is searched one ply deeper.
+inline constexpr int SINGULAR_MIN_DEPTH        = 7;
+inline constexpr int SINGULAR_TT_DEPTH_MARGIN  = 3; // The entry may be this much shallower.
+inline constexpr int SINGULAR_MARGIN_PER_DEPTH = 2;
+
+[[nodiscard]] constexpr int singularBeta(int tt_value, int depth) noexcept {
+    return tt_value - (SINGULAR_MARGIN_PER_DEPTH * depth);
+}
+
+[[nodiscard]] constexpr int singularSearchDepth(int depth) noexcept { return (depth - 1) / 2; }
+
+// Whether the TT entry of a node at this depth is a candidate for a singular extension. An upper
+// bound says nothing about how good the TT move is.
+[[nodiscard]] inline bool isSingularCandidate(const TranspositionTableEntry& entry,
+                                              int                            depth) noexcept {
+    return depth >= SINGULAR_MIN_DEPTH && entry.found() && entry.best_move != PACKED_MOVE_NONE &&
+           entry.evaluation_type != TranspositionTableEvaluationType::UPPERBOUND &&
+           entry.depth >= depth - SINGULAR_TT_DEPTH_MARGIN &&
+           std::abs(entry.value) < CHECKMATE_THRESHOLD;
+}
+
+} // namespace bitcrusher::heuristics
+
+#endif // BITCRUSHER_HEURISTICS_EXTENSIONS_HPP
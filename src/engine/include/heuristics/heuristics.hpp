@@ -1,8 +1,14 @@
 #ifndef BITCRUSHER_HEURISTICS_HPP
 #define BITCRUSHER_HEURISTICS_HPP
 
+#include "extensions.hpp"
+#include "move_ordering/quiet_move_history.hpp"
 #include "move_ordering/score_moves.hpp"
+#include "pruning/futility.hpp"
+#include "pruning/late_move_reductions.hpp"
 #include "pruning/mate_distance.hpp"
+#include "pruning/null_move.hpp"
 #include "search_config.hpp"
+#include "static_exchange.hpp"
 
 #endif // BITCRUSHER_HEURISTICS_HPP
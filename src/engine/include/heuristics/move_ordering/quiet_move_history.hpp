@@ -0,0 +1,128 @@
+#ifndef BITCRUSHER_HEURISTICS_QUIET_MOVE_HISTORY_HPP
+#define BITCRUSHER_HEURISTICS_QUIET_MOVE_HISTORY_HPP
+
+#include "bitboard_enums.hpp"
+#include "move.hpp"
+#include "move_sink.hpp"
+#include "search_config.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <utility>
+
+namespace bitcrusher::heuristics {
+
+// Ordering tables for quiet moves, learned from beta cutoffs. Each search thread owns its own.
+
+inline constexpr int KILLER_SLOTS = 2;
+
+// History scores stay within [-HISTORY_MAX, HISTORY_MAX], below the killer move scores.
+inline constexpr int HISTORY_MAX       = 4'000;
+inline constexpr int HISTORY_MAX_BONUS = 1'200;
+
+// Bonus for a quiet move causing a cutoff at this remaining depth; the same amount is taken from
+// the quiet moves searched before it.
+[[nodiscard]] constexpr int historyBonus(int depth) noexcept {
+    return std::min(depth * depth, HISTORY_MAX_BONUS);
+}
+
+// Quiet moves that caused a beta cutoff at the same ply, most recent first.
+class KillerMoves {
+public:
+    void store(int ply, const Move& move) noexcept {
+        auto& slots = killers_[ply];
+        if (slots[0] != move) {
+            slots[1] = slots[0];
+            slots[0] = move;
+        }
+    }
+
+    // Slot 0 for the most recent killer, KILLER_SLOTS if the move is not a killer.
+    [[nodiscard]] int slotOf(int ply, const Move& move) const noexcept {
+        const auto& slots = killers_[ply];
+        const auto  found = std::find(slots.begin(), slots.end(), move);
+        return static_cast<int>(found - slots.begin());
+    }
+
+private:
+    // A default constructed Move is Move::none().
+    std::array<std::array<Move, KILLER_SLOTS>, MAX_PLY + 1> killers_{};
+};
+
+// Butterfly history: how often a quiet move from one square to another caused a cutoff, per side.
+class ButterflyHistory {
+public:
+    template <Color Side> [[nodiscard]] int get(const Move& move) const noexcept {
+        return table_[std::to_underlying(Side)][std::to_underlying(move.fromSquare())]
+                     [std::to_underlying(move.toSquare())];
+    }
+
+    // Gravity update: the closer an entry is to HISTORY_MAX, the less a bonus of the same sign
+    // moves it, so old results fade and scores never leave the range.
+    template <Color Side> void update(const Move& move, int bonus) noexcept {
+        int16_t& entry = table_[std::to_underlying(Side)][std::to_underlying(move.fromSquare())]
+                               [std::to_underlying(move.toSquare())];
+        entry += static_cast<int16_t>(bonus - (entry * std::abs(bonus) / HISTORY_MAX));
+    }
+
+private:
+    std::array<std::array<std::array<int16_t, SQUARE_COUNT>, SQUARE_COUNT>, 2> table_{};
+};
+
+// The quiet reply that last refuted each opponent move, by the moved piece and its target square.
+class CounterMoveTable {
+public:
+    template <Color Side> [[nodiscard]] Move get(const Move& previous_move) const noexcept {
+        if (previous_move.isNullMove()) {
+            return Move::none();
+        }
+        return table_[std::to_underlying(Side)][std::to_underlying(previous_move.movingPiece())]
+                     [std::to_underlying(previous_move.toSquare())];
+    }
+
+    template <Color Side> void store(const Move& previous_move, const Move& move) noexcept {
+        if (! previous_move.isNullMove()) {
+            table_[std::to_underlying(Side)][std::to_underlying(previous_move.movingPiece())]
+                  [std::to_underlying(previous_move.toSquare())] = move;
+        }
+    }
+
+private:
+    std::array<std::array<std::array<Move, SQUARE_COUNT>, PIECE_COUNT_PER_SIDE>, 2> table_{};
+};
+
+struct QuietMoveHistory {
+    KillerMoves      killers;
+    ButterflyHistory butterfly;
+    CounterMoveTable countermoves;
+};
+
+// Records a beta cutoff by a quiet move. The quiet moves searched before it at the same node
+// failed to cut off and lose history.
+template <SearchConfig Config, Color Side>
+void updateQuietMoveHistory(QuietMoveHistory&     history,
+                            int                   ply,
+                            int                   depth,
+                            const Move&           cutoff_move,
+                            const Move&           previous_move,
+                            std::span<const Move> searched_quiets) noexcept {
+    if constexpr (Config.quiet_move_ordering.killer_moves) {
+        history.killers.store(ply, cutoff_move);
+    }
+    if constexpr (Config.quiet_move_ordering.history) {
+        const int bonus = historyBonus(depth);
+        history.butterfly.update<Side>(cutoff_move, bonus);
+        for (const Move& move : searched_quiets) {
+            history.butterfly.update<Side>(move, -bonus);
+        }
+    }
+    if constexpr (Config.quiet_move_ordering.countermoves) {
+        history.countermoves.store<Side>(previous_move, cutoff_move);
+    }
+}
+
+} // namespace bitcrusher::heuristics
+
+#endif // BITCRUSHER_HEURISTICS_QUIET_MOVE_HISTORY_HPP
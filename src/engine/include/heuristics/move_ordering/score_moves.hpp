@@ -3,6 +3,7 @@
 
 #include "move.hpp"
 #include "move_sink.hpp"
+#include "quiet_move_history.hpp"
 #include "search_config.hpp"
 #include <utility>
 
@@ -25,29 +26,52 @@ namespace bitcrusher::heuristics {
     }
 }
 
-// Score a move for ordering in the main search.
-// Priority (highest first): TT move, captures (MVV-LVA), promotions, quiet.
-template <SearchConfig Config>
-[[nodiscard]] constexpr int scoreMoveMain(const Move& move, const Move& tt_move) noexcept {
-    if constexpr (Config.tt_move_ordering.enabled) {
-        if (move == tt_move)
-            return 1'000'000;
-    }
-    if (move.isCapture()) {
-        if constexpr (Config.mvv_lva.enabled) {
-            return (10 * mvvLvaPieceValue(move.capturedPiece())) -
-                   mvvLvaPieceValue(move.movingPiece()) + 10'000;
-        }
-        return 10'000;
+inline constexpr int CAPTURE_SCORE     = 10'000;
+inline constexpr int PROMOTION_SCORE   = 5'900;
+inline constexpr int KILLER_MOVE_SCORE = 5'000; // Minus 100 for each older killer slot.
+inline constexpr int COUNTERMOVE_SCORE = 4'500;
+
+// Score a capture for ordering in the main search by MVV-LVA. Whether it loses material is only
+// decided once it is picked, see MovePicker.
+template <SearchConfig Config> [[nodiscard]] constexpr int scoreCapture(const Move& move) noexcept {
+    if constexpr (Config.mvv_lva.enabled) {
+        return CAPTURE_SCORE + (10 * mvvLvaPieceValue(move.capturedPiece())) -
+               mvvLvaPieceValue(move.movingPiece());
     }
+    return CAPTURE_SCORE;
+}
+
+// Score a non-capture for ordering in the main search.
+// Priority (highest first): promotions, killer moves, countermove, the rest by history.
+template <SearchConfig Config, Color Side>
+[[nodiscard]] inline int scoreQuiet(const Move&             move,
+                                    const QuietMoveHistory& history,
+                                    int                     ply,
+                                    const Move&             countermove) noexcept {
     if (move.isPromotion())
-        return 5'900;
+        return PROMOTION_SCORE;
+    if constexpr (Config.quiet_move_ordering.killer_moves) {
+        const int killer_slot = history.killers.slotOf(ply, move);
+        if (killer_slot < KILLER_SLOTS)
+            return KILLER_MOVE_SCORE - (100 * killer_slot);
+    }
+    if constexpr (Config.quiet_move_ordering.countermoves) {
+        if (move == countermove)
+            return COUNTERMOVE_SCORE;
+    }
+    if constexpr (Config.quiet_move_ordering.history) {
+        return history.butterfly.get<Side>(move);
+    }
     return 0;
 }
 
-// Score a move for ordering in quiescence search (captures and promotions only).
+// Score a move for ordering in quiescence search (captures and promotions, evasions in check).
 template <SearchConfig Config>
-[[nodiscard]] constexpr int scoreMoveQuiescence(const Move& move) noexcept {
+[[nodiscard]] constexpr int scoreMoveQuiescence(const Move& move, PackedMove tt_move) noexcept {
+    if constexpr (Config.tt_move_ordering.enabled) {
+        if (packMove(move) == tt_move)
+            return 1'000'000;
+    }
     if (move.isCapture()) {
         if constexpr (Config.mvv_lva.enabled) {
             return (10 * mvvLvaPieceValue(move.capturedPiece())) -
@@ -60,33 +84,25 @@ template <SearchConfig Config>
     return 0;
 }
 
-template <MoveSink MoveSinkT> void sortMoves(MoveSinkT& sink, int* move_scores, int ply) {
-    int count = sink.count[ply];
-    for (int i = 0; i < count - 1; ++i) {
-        int best_idx = i;
-        for (int j = i + 1; j < count; ++j) {
-            if (move_scores[j] > move_scores[best_idx])
-                best_idx = j;
-        }
-        std::swap(sink.moves[ply][i], sink.moves[ply][best_idx]);
-        std::swap(move_scores[i], move_scores[best_idx]);
+// Moves the best scored of the ply's moves [index, end) to index, together with its score.
+// Picking one move at a time, instead of sorting up front, leaves the moves after a cutoff
+// untouched.
+template <MoveSink MoveSinkT> void pickBest(MoveSinkT& sink, int ply, int index, int end) {
+    auto& moves  = sink.moves[ply];
+    auto& scores = sink.scores[ply];
+    int   best   = index;
+    for (int i = index + 1; i < end; ++i) {
+        if (scores[i] > scores[best])
+            best = i;
     }
+    std::swap(moves[index], moves[best]);
+    std::swap(scores[index], scores[best]);
 }
 
 template <SearchConfig Config, MoveSink MoveSinkT>
-void scoreAndSortQuiescence(MoveSinkT& sink, int ply) {
-    int move_scores[MAX_LEGAL_MOVES];
-    for (int i = 0; i < sink.count[ply]; ++i)
-        move_scores[i] = scoreMoveQuiescence<Config>(sink.moves[ply][i]);
-    sortMoves(sink, move_scores, ply);
-}
-
-template <SearchConfig Config, MoveSink MoveSinkT>
-void scoreAndSort(MoveSinkT& sink, const Move& tt_move, int ply) {
-    int move_scores[MAX_LEGAL_MOVES];
+void scoreQuiescenceMoves(MoveSinkT& sink, PackedMove tt_move, int ply) {
     for (int i = 0; i < sink.count[ply]; ++i)
-        move_scores[i] = scoreMoveMain<Config>(sink.moves[ply][i], tt_move);
-    sortMoves(sink, move_scores, ply);
+        sink.scores[ply][i] = scoreMoveQuiescence<Config>(sink.moves[ply][i], tt_move);
 }
 
 } // namespace bitcrusher::heuristics
@@ -0,0 +1,44 @@
+#ifndef BITCRUSHER_HEURISTICS_FUTILITY_HPP
+#define BITCRUSHER_HEURISTICS_FUTILITY_HPP
+
+#include "bitboard_enums.hpp"
+#include "move.hpp"
+#include "static_exchange.hpp"
+
+namespace bitcrusher::heuristics {
+
+// Quiescence: a capture is skipped when even winning the captured piece plus this margin cannot
+// bring the static evaluation up to alpha.
+inline constexpr int DELTA_MARGIN = 200;
+
+// Main search: quiet moves are skipped at depth <= FUTILITY_MAX_DEPTH when the static evaluation
+// plus the margin for the remaining depth stays at or below alpha.
+inline constexpr int FUTILITY_MAX_DEPTH        = 3;
+inline constexpr int FUTILITY_BASE_MARGIN      = 100;
+inline constexpr int FUTILITY_MARGIN_PER_DEPTH = 150;
+
+// Main search: a node at depth <= REVERSE_FUTILITY_MAX_DEPTH whose static evaluation exceeds beta
+// by the margin for the remaining depth returns without searching (static null move).
+inline constexpr int REVERSE_FUTILITY_MAX_DEPTH        = 6;
+inline constexpr int REVERSE_FUTILITY_MARGIN_PER_DEPTH = 100;
+
+[[nodiscard]] constexpr int futilityMargin(int depth) noexcept {
+    return FUTILITY_BASE_MARGIN + (FUTILITY_MARGIN_PER_DEPTH * depth);
+}
+
+[[nodiscard]] constexpr int reverseFutilityMargin(int depth) noexcept {
+    return REVERSE_FUTILITY_MARGIN_PER_DEPTH * depth;
+}
+
+// The most material a capture or promotion can win before any recapture.
+[[nodiscard]] constexpr int materialGain(const Move& move) noexcept {
+    int gain = move.isCapture() ? seePieceValue(move.capturedPiece()) : 0;
+    if (move.isPromotion()) {
+        gain += seePieceValue(move.promotionPiece()) - seePieceValue(PieceType::PAWN);
+    }
+    return gain;
+}
+
+} // namespace bitcrusher::heuristics
+
+#endif // BITCRUSHER_HEURISTICS_FUTILITY_HPP
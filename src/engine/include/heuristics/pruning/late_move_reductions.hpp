@@ -0,0 +1,43 @@
+#ifndef BITCRUSHER_HEURISTICS_LATE_MOVE_REDUCTIONS_HPP
+#define BITCRUSHER_HEURISTICS_LATE_MOVE_REDUCTIONS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace bitcrusher::heuristics {
+
+inline constexpr int LMR_MIN_DEPTH      = 3;
+inline constexpr int LMR_MIN_MOVE_INDEX = 3; // The first moves after sorting are never reduced.
+inline constexpr int LMR_TABLE_SIZE     = 64;
+
+inline constexpr double LMR_BASE    = 0.75;
+inline constexpr double LMR_DIVISOR = 2.25;
+
+// Reduction in plies by [depth][move index], growing with the logarithm of both.
+inline const std::array<std::array<uint8_t, LMR_TABLE_SIZE>, LMR_TABLE_SIZE> LMR_TABLE = [] {
+    std::array<std::array<uint8_t, LMR_TABLE_SIZE>, LMR_TABLE_SIZE> table{};
+    for (int depth = 1; depth < LMR_TABLE_SIZE; ++depth) {
+        for (int move_index = 1; move_index < LMR_TABLE_SIZE; ++move_index) {
+            table[depth][move_index] = static_cast<uint8_t>(
+                LMR_BASE + (std::log(depth) * std::log(move_index) / LMR_DIVISOR));
+        }
+    }
+    return table;
+}();
+
+// Reduction for a late quiet move. PV nodes are reduced one ply less, and a reduced search
+// always keeps at least one ply.
+[[nodiscard]] inline int lateMoveReduction(int depth, int move_index, bool pv_node) noexcept {
+    int reduction = LMR_TABLE[std::min(depth, LMR_TABLE_SIZE - 1)]
+                             [std::min(move_index, LMR_TABLE_SIZE - 1)];
+    if (pv_node) {
+        reduction = std::max(reduction - 1, 0);
+    }
+    return std::clamp(reduction, 0, depth - 2);
+}
+
+} // namespace bitcrusher::heuristics
+
+#endif // BITCRUSHER_HEURISTICS_LATE_MOVE_REDUCTIONS_HPP
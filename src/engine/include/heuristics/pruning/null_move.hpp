@@ -0,0 +1,35 @@
+#ifndef BITCRUSHER_HEURISTICS_NULL_MOVE_HPP
+#define BITCRUSHER_HEURISTICS_NULL_MOVE_HPP
+
+#include "bitboard_enums.hpp"
+#include "board_state.hpp"
+#include <algorithm>
+
+namespace bitcrusher::heuristics {
+
+inline constexpr int NULL_MOVE_MIN_DEPTH      = 3;
+inline constexpr int NULL_MOVE_BASE_REDUCTION = 2;
+inline constexpr int NULL_MOVE_DEPTH_DIVISOR  = 4; // One more ply of reduction every 4 plies.
+inline constexpr int NULL_MOVE_EVAL_MARGIN    = 200;
+inline constexpr int NULL_MOVE_MAX_EVAL_BONUS = 2;
+
+// Positions where passing may be the best option (zugzwang) mostly have only king and pawns
+// left for the side to move, so null-move pruning is skipped there.
+template <Color Side>
+[[nodiscard]] constexpr bool hasNonPawnMaterial(const BoardState& board) noexcept {
+    return (board.getBitboard<PieceType::KNIGHT, Side>() |
+            board.getBitboard<PieceType::BISHOP, Side>() |
+            board.getBitboard<PieceType::ROOK, Side>() |
+            board.getBitboard<PieceType::QUEEN, Side>()) != 0;
+}
+
+// Adaptive depth reduction R: deeper nodes and positions far above beta are reduced more.
+[[nodiscard]] constexpr int nullMoveReduction(int depth, int static_eval, int beta) noexcept {
+    const int eval_bonus = std::clamp((static_eval - beta) / NULL_MOVE_EVAL_MARGIN, 0,
+                                      NULL_MOVE_MAX_EVAL_BONUS);
+    return NULL_MOVE_BASE_REDUCTION + (depth / NULL_MOVE_DEPTH_DIVISOR) + eval_bonus;
+}
+
+} // namespace bitcrusher::heuristics
+
+#endif // BITCRUSHER_HEURISTICS_NULL_MOVE_HPP
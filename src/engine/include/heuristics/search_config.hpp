@@ -12,26 +12,97 @@ struct MVVLVAConfig {
 };
 
 struct QuiescenceConfig {
+    bool enabled                 = false;
+    bool use_transposition_table = false; // Probe, store and order by the TT move in quiescence.
+};
+
+struct DeltaPruningConfig {
+    bool enabled = false; // Skip quiescence captures that cannot raise the evaluation to alpha.
+};
+
+struct FutilityPruningConfig {
+    bool enabled = false; // Skip quiet moves near the horizon when far below alpha.
+};
+
+struct ReverseFutilityPruningConfig {
+    bool enabled = false; // Cut off near the horizon when the evaluation is far above beta.
+};
+
+struct NullMovePruningConfig {
+    bool enabled = false;
+};
+
+// Search moves after the first with a zero window, re-searching with the full window only when
+// one of them turns out to be better.
+struct PrincipalVariationSearchConfig {
     bool enabled = false;
 };
 
+struct LateMoveReductionsConfig {
+    bool enabled = false;
+};
+
+// Search forcing lines deeper instead of letting them reach the horizon.
+struct ExtensionsConfig {
+    bool check    = false; // Positions in check.
+    bool singular = false; // TT moves clearly better than every alternative.
+};
+
+struct StaticExchangeConfig {
+    bool capture_ordering   = false; // Order captures that lose material after quiet moves.
+    bool quiescence_pruning = false; // Skip losing captures in quiescence search.
+};
+
+// Order quiet moves by what caused beta cutoffs earlier in the search.
+struct QuietMoveOrderingConfig {
+    bool killer_moves = false; // Quiet cutoff moves at the same ply.
+    bool history      = false; // Butterfly history with gravity updates.
+    bool countermoves = false; // The quiet move that last refuted the opponent's previous move.
+};
+
 struct SearchConfig {
-    TTMoveOrderingConfig tt_move_ordering{};
-    MVVLVAConfig         mvv_lva{};
-    QuiescenceConfig     quiescence{};
+    TTMoveOrderingConfig           tt_move_ordering{};
+    MVVLVAConfig                   mvv_lva{};
+    QuiescenceConfig               quiescence{};
+    NullMovePruningConfig          null_move_pruning{};
+    PrincipalVariationSearchConfig principal_variation_search{};
+    LateMoveReductionsConfig       late_move_reductions{};
+    ExtensionsConfig               extensions{};
+    StaticExchangeConfig           static_exchange{};
+    QuietMoveOrderingConfig        quiet_move_ordering{};
+    DeltaPruningConfig             delta_pruning{};
+    FutilityPruningConfig          futility_pruning{};
+    ReverseFutilityPruningConfig   reverse_futility_pruning{};
 };
 
 // Matches the current engine behaviour.
 inline constexpr SearchConfig DEFAULT_CONFIG{
-    .tt_move_ordering = {.enabled = true},
-    .mvv_lva          = {.enabled = true},
-    .quiescence       = {.enabled = true},
+    .tt_move_ordering           = {.enabled = true},
+    .mvv_lva                    = {.enabled = true},
+    .quiescence                 = {.enabled = true, .use_transposition_table = true},
+    .null_move_pruning          = {.enabled = true},
+    .principal_variation_search = {.enabled = true},
+    .late_move_reductions       = {.enabled = true},
+    .extensions                 = {.check = true, .singular = true},
+    .static_exchange            = {.capture_ordering = true, .quiescence_pruning = true},
+    .quiet_move_ordering        = {.killer_moves = true, .history = true, .countermoves = true},
+    .delta_pruning              = {.enabled = true},
+    .futility_pruning           = {.enabled = true},
+    .reverse_futility_pruning   = {.enabled = true},
 };
 
 // Used when SearchParameters::use_quiescence_search is false.
 inline constexpr SearchConfig NO_QUIESCENCE_CONFIG{
-    .tt_move_ordering = {.enabled = true},
-    .mvv_lva          = {.enabled = true},
+    .tt_move_ordering           = {.enabled = true},
+    .mvv_lva                    = {.enabled = true},
+    .null_move_pruning          = {.enabled = true},
+    .principal_variation_search = {.enabled = true},
+    .late_move_reductions       = {.enabled = true},
+    .extensions                 = {.check = true, .singular = true},
+    .static_exchange            = {.capture_ordering = true},
+    .quiet_move_ordering        = {.killer_moves = true, .history = true, .countermoves = true},
+    .futility_pruning           = {.enabled = true},
+    .reverse_futility_pruning   = {.enabled = true},
 };
 
 } // namespace bitcrusher
@@ -0,0 +1,123 @@
+#ifndef BITCRUSHER_HEURISTICS_STATIC_EXCHANGE_HPP
+#define BITCRUSHER_HEURISTICS_STATIC_EXCHANGE_HPP
+
+#include "bitboard_conversions.hpp"
+#include "bitboard_enums.hpp"
+#include "board_state.hpp"
+#include "move.hpp"
+#include "squares_attacked.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace bitcrusher::heuristics {
+
+// The longest capture sequence on one square: every piece of both sides.
+inline constexpr int SEE_MAX_EXCHANGES = 32;
+
+[[nodiscard]] constexpr int seePieceValue(PieceType piece_type) noexcept {
+    switch (piece_type) {
+    case PieceType::KING:
+        return 20'000; // Never captures onto a square that is still defended.
+    case PieceType::QUEEN:
+        return 900;
+    case PieceType::ROOK:
+        return 500;
+    case PieceType::BISHOP:
+        return 330;
+    case PieceType::KNIGHT:
+        return 320;
+    case PieceType::PAWN:
+        return 100;
+    default:
+        return 0;
+    }
+}
+
+template <PieceType Piece>
+[[nodiscard]] constexpr uint64_t piecesOfBothSides(const BoardState& board) noexcept {
+    return board.getBitboard<Piece, Color::WHITE>() | board.getBitboard<Piece, Color::BLACK>();
+}
+
+/// @brief Static exchange evaluation: material won by the side making the capture, assuming both
+/// sides keep recapturing on the target square with their least valuable attacker and either side
+/// may stop when continuing would lose material.
+///
+/// Attackers behind other pieces (x-rays) join the exchange once the pieces in front of them have
+/// captured. Pins and checks are ignored.
+template <Color Side>
+[[nodiscard]] inline int staticExchangeEvaluation(const BoardState& board, const Move& move) {
+    const Square target    = move.toSquare();
+    uint64_t     occupancy = board.getAllOccupancy() ^ convert::toBitboard(move.fromSquare());
+
+    std::array<int, SEE_MAX_EXCHANGES> gain{};
+    gain[0]                   = move.isCapture() ? seePieceValue(move.capturedPiece()) : 0;
+    PieceType piece_on_target = move.movingPiece(); // The promoted piece for promotions.
+    if (move.isPromotion()) {
+        gain[0] += seePieceValue(piece_on_target) - seePieceValue(PieceType::PAWN);
+    }
+    if (move.isEnPassant()) {
+        // The captured pawn is beside the moving pawn, not on the target square.
+        const Square captured_pawn =
+            Square{static_cast<uint8_t>((std::to_underlying(move.fromSquare()) & ~7) |
+                                        (std::to_underlying(target) & 7))};
+        occupancy ^= convert::toBitboard(captured_pawn);
+    }
+
+    // Indexed by PieceType, from the least valuable piece up.
+    const std::array<uint64_t, 6> pieces{
+        piecesOfBothSides<PieceType::PAWN>(board),   piecesOfBothSides<PieceType::KNIGHT>(board),
+        piecesOfBothSides<PieceType::BISHOP>(board), piecesOfBothSides<PieceType::ROOK>(board),
+        piecesOfBothSides<PieceType::QUEEN>(board),  piecesOfBothSides<PieceType::KING>(board)};
+    const std::array<uint64_t, 2> side_occupancy{board.getOwnOccupancy<Side>(),
+                                                 board.getOpponentOccupancy<Side>()};
+    uint64_t attackers = generateAttackersTo(board, target, occupancy);
+    int      depth     = 0;
+    while (true) {
+        // The side to capture next: the opponent on odd depths.
+        const uint64_t side_attackers = attackers & side_occupancy[(depth + 1) & 1];
+        if (side_attackers == 0 || depth + 1 >= SEE_MAX_EXCHANGES) {
+            break;
+        }
+        ++depth;
+        // Score if the piece on the target is captured and the exchange stopped here.
+        gain[depth] = seePieceValue(piece_on_target) - gain[depth - 1];
+        if (std::max(-gain[depth - 1], gain[depth]) < 0) {
+            break; // Neither side would continue, the result is decided.
+        }
+
+        // Least valuable attacker captures next.
+        for (int piece_index = 0; piece_index < static_cast<int>(pieces.size()); ++piece_index) {
+            const uint64_t candidates = side_attackers & pieces[piece_index];
+            if (candidates != 0) {
+                occupancy ^= candidates & (~candidates + 1); // Lowest set bit.
+                piece_on_target = static_cast<PieceType>(piece_index);
+                break;
+            }
+        }
+        attackers = generateAttackersTo(board, target, occupancy);
+    }
+
+    // Each side chooses between capturing and standing pat, from the last capture backwards.
+    while (depth > 0) {
+        gain[depth - 1] = -std::max(-gain[depth - 1], gain[depth]);
+        --depth;
+    }
+    return gain[0];
+}
+
+// Taking a piece worth at least the capturer never loses material, so the full SEE only runs for
+// the remaining captures.
+template <Color Side>
+[[nodiscard]] inline bool isLosingCapture(const BoardState& board, const Move& move) {
+    if (! move.isPromotion() &&
+        seePieceValue(move.capturedPiece()) >= seePieceValue(move.movingPiece())) {
+        return false;
+    }
+    return staticExchangeEvaluation<Side>(board, move) < 0;
+}
+
+} // namespace bitcrusher::heuristics
+
+#endif // BITCRUSHER_HEURISTICS_STATIC_EXCHANGE_HPP
@@ -47,8 +47,10 @@ void generateLegalKingMoves(const BoardState&        board,
     // Captures.
     const uint64_t king_attacks = generateKingAttacks(king_square) &
                                   (~generateSquaresAttackedXRayingOpponentKing<! Side>(board));
-    generateCaptures<Side, PieceType::KING>(king_attacks, sink, board, king_square);
-    if constexpr (MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_CAPTURES_ONLY) {
+    if constexpr (generatesCaptures<MoveGenerationP>()) {
+        generateCaptures<Side, PieceType::KING>(king_attacks, sink, board, king_square);
+    }
+    if constexpr (! generatesQuiets<MoveGenerationP>()) {
         return;
     }
 
@@ -30,9 +30,10 @@ void generateLegalKnightMoves(const BoardState&         board,
         uint64_t knight_attacks =
             generateKnightAttacks(knight_square) & restriction_context.checkmask;
         uint64_t knight_quiet_moves = knight_attacks & board.getEmptySquares();
-        generateCaptures<Side, PieceType::KNIGHT>(knight_attacks, sink, board, knight_square);
-        if constexpr (MoveGenerationP == MoveGenerationPolicy::TESTS_FULL ||
-                      MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_FULL) {
+        if constexpr (generatesCaptures<MoveGenerationP>()) {
+            generateCaptures<Side, PieceType::KNIGHT>(knight_attacks, sink, board, knight_square);
+        }
+        if constexpr (generatesQuiets<MoveGenerationP>()) {
             createMovesFromBitboard<MoveType::QUIET, PieceType::KNIGHT, Side>(
                 sink, knight_quiet_moves, knight_square);
         }
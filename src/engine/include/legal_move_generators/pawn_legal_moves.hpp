@@ -145,12 +145,14 @@ void generateLegalPawnMoves(const BoardState&         board,
                                          restriction_context.pinmask_diagonal;
 
     // Attacks and en_passant
-    generatePawnCaptureMoves<MoveSinkT, Side, Direction::LEFT, MoveGenerationP>(
-        board, pawns_not_pinned, pawns_pinned_only_d, restriction_context, sink);
-    generatePawnCaptureMoves<MoveSinkT, Side, Direction::RIGHT, MoveGenerationP>(
-        board, pawns_not_pinned, pawns_pinned_only_d, restriction_context, sink);
+    if constexpr (generatesCaptures<MoveGenerationP>()) {
+        generatePawnCaptureMoves<MoveSinkT, Side, Direction::LEFT, MoveGenerationP>(
+            board, pawns_not_pinned, pawns_pinned_only_d, restriction_context, sink);
+        generatePawnCaptureMoves<MoveSinkT, Side, Direction::RIGHT, MoveGenerationP>(
+            board, pawns_not_pinned, pawns_pinned_only_d, restriction_context, sink);
+    }
 
-    if constexpr (MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_CAPTURES_ONLY) {
+    if constexpr (! generatesQuiets<MoveGenerationP>()) {
         return;
     }
     // Single pawn pushes
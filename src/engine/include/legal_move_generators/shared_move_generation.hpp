@@ -12,9 +12,21 @@ namespace bitcrusher {
 enum class MoveGenerationPolicy : uint8_t {
     TESTS_FULL,               // Generates all legal moves (Perft standard)
     COMPETITIVE_FULL,         // Skips Rook/Bishop non-capture underpromotions
-    COMPETITIVE_CAPTURES_ONLY // Skips Rook/Bishop capture underpromotions
+    COMPETITIVE_CAPTURES_ONLY, // Skips Rook/Bishop capture underpromotions
+    COMPETITIVE_QUIETS_ONLY    // The moves of COMPETITIVE_FULL that COMPETITIVE_CAPTURES_ONLY skips
 };
 
+/// @brief Whether the policy produces captures, including en passant and promotion captures.
+template <MoveGenerationPolicy MoveGenerationP> [[nodiscard]] constexpr bool generatesCaptures() {
+    return MoveGenerationP != MoveGenerationPolicy::COMPETITIVE_QUIETS_ONLY;
+}
+
+/// @brief Whether the policy produces non-captures: quiet moves, pawn pushes, push promotions and
+/// castling.
+template <MoveGenerationPolicy MoveGenerationP> [[nodiscard]] constexpr bool generatesQuiets() {
+    return MoveGenerationP != MoveGenerationPolicy::COMPETITIVE_CAPTURES_ONLY;
+}
+
 /// @brief Creates moves given a target squares bitboard and an offset to calculate the source
 /// square of the moving piece .
 /// @tparam MoveT The type of move being created.
@@ -218,9 +230,10 @@ void generateDiagonalSlidingPieceMoves(uint64_t          source_squares,
         uint64_t piece_attacks{};
         piece_attacks = getDiagonalAttacks(piece_sq, board.getAllOccupancy()) & restriction_mask;
 
-        generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
-        if constexpr (MoveGenerationP == MoveGenerationPolicy::TESTS_FULL ||
-                      MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_FULL) {
+        if constexpr (generatesCaptures<MoveGenerationP>()) {
+            generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
+        }
+        if constexpr (generatesQuiets<MoveGenerationP>()) {
             uint64_t quiet_moves = piece_attacks & board.getEmptySquares();
             createMovesFromBitboard<MoveType::QUIET, MovedPieceT, Side>(sink, quiet_moves,
                                                                         piece_sq);
@@ -232,9 +245,10 @@ void generateDiagonalSlidingPieceMoves(uint64_t          source_squares,
         uint64_t piece_bb = convert::toBitboard(piece_sq);
         uint64_t piece_attacks =
             generateDiagonalAttacks(piece_bb, board.getAllOccupancy()) & restriction_mask;
-        generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
-        if constexpr (MoveGenerationP == MoveGenerationPolicy::TESTS_FULL ||
-                      MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_FULL) {
+        if constexpr (generatesCaptures<MoveGenerationP>()) {
+            generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
+        }
+        if constexpr (generatesQuiets<MoveGenerationP>()) {
             uint64_t quiet_moves = piece_attacks & board.getEmptySquares();
             createMovesFromBitboard<MoveType::QUIET, MovedPieceT, Side>(sink, quiet_moves,
                                                                         piece_sq);
@@ -270,9 +284,10 @@ void generateHorizontalVerticalSlidingPieceMoves(uint64_t          source_square
         piece_attacks =
             getHorizontalVerticalAttacks(piece_sq, board.getAllOccupancy()) & restriction_mask;
 
-        generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
-        if constexpr (MoveGenerationP == MoveGenerationPolicy::TESTS_FULL ||
-                      MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_FULL) {
+        if constexpr (generatesCaptures<MoveGenerationP>()) {
+            generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
+        }
+        if constexpr (generatesQuiets<MoveGenerationP>()) {
             uint64_t quiet_moves = piece_attacks & board.getEmptySquares();
             createMovesFromBitboard<MoveType::QUIET, MovedPieceT, Side>(sink, quiet_moves,
                                                                         piece_sq);
@@ -284,10 +299,11 @@ void generateHorizontalVerticalSlidingPieceMoves(uint64_t          source_square
         uint64_t piece_bb = convert::toBitboard(piece_sq);
         uint64_t piece_attacks =
             generateHorizontalVerticalAttacks(piece_bb, board.getAllOccupancy()) & restriction_mask;
-        generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
+        if constexpr (generatesCaptures<MoveGenerationP>()) {
+            generateCaptures<Side, MovedPieceT>(piece_attacks, sink, board, piece_sq);
+        }
 
-        if constexpr (MoveGenerationP == MoveGenerationPolicy::TESTS_FULL ||
-                      MoveGenerationP == MoveGenerationPolicy::COMPETITIVE_FULL) {
+        if constexpr (generatesQuiets<MoveGenerationP>()) {
             uint64_t quiet_moves = piece_attacks & board.getEmptySquares();
             createMovesFromBitboard<MoveType::QUIET, MovedPieceT, Side>(sink, quiet_moves,
                                                                         piece_sq);
@@ -161,6 +161,21 @@ private:
     return std::format("{}{}{}{}{}", from_file, from_rank, to_file, to_rank, promo_char);
 }
 
+/// @brief Compact 16-bit move encoding used by the transposition table.
+///
+/// Bits 0-5 hold the from square, bits 6-11 the to square and bits 12-14 the promotion piece
+/// (0 when the move is not a promotion). This is enough to identify a move among the legal moves
+/// of a position; Move::none() packs to 0.
+using PackedMove = uint16_t;
+
+inline constexpr PackedMove PACKED_MOVE_NONE = 0;
+
+[[nodiscard]] constexpr PackedMove packMove(const Move& move) noexcept {
+    const auto promotion = move.isPromotion() ? std::to_underlying(move.promotionPiece()) : 0;
+    return static_cast<PackedMove>(std::to_underlying(move.fromSquare()) |
+                                   (std::to_underlying(move.toSquare()) << 6) | (promotion << 12));
+}
+
 } // namespace bitcrusher
 
 static_assert(std::is_trivially_copyable_v<bitcrusher::Move>, "Move must be trivially copyable");
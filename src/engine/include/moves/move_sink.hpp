@@ -16,6 +16,8 @@ struct FastMoveSink : MoveSinkBase<FastMoveSink> {
     std::array<std::array<Move, MAX_LEGAL_MOVES>, MAX_PLY> moves{};
     std::array<int, MAX_PLY>                               count{};
     int                                                    ply = -1;
+    // Move ordering scores, scores[ply][i] belongs to moves[ply][i]. Set by the search.
+    std::array<std::array<int, MAX_LEGAL_MOVES>, MAX_PLY> scores{};
 
     template <MoveType  MoveT,
               PieceType MovedOrPromotedToPiece,
@@ -0,0 +1,76 @@
+#ifndef BITCRUSHER_EVALUATION_CACHE_HPP
+#define BITCRUSHER_EVALUATION_CACHE_HPP
+
+#include "large_page_buffer.hpp"
+#include "search_statistics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+namespace bitcrusher {
+
+inline constexpr size_t DEFAULT_EVAL_CACHE_SIZE = 1 << 18; // Number of entries. Power of 2.
+
+/// @brief Static evaluations keyed by Zobrist hash, shared by all search threads.
+///
+/// Positions reached by transposition are evaluated once. Each entry is a single 64-bit word
+/// holding the upper 32 bits of the key and the evaluation of the side to move, so it is read and
+/// written whole through a relaxed std::atomic_ref and needs no locking or XOR verification. An
+/// all-zero word marks an empty entry. Newer stores always replace older ones.
+class EvaluationCache {
+    LargePageBuffer memory_;
+    uint64_t*       table_{nullptr};
+    size_t          entry_count_{0};
+    uint64_t        mask_{0};
+
+    static constexpr uint64_t KEY_MASK = 0xFFFF'FFFF'0000'0000ULL;
+
+    [[nodiscard]] static uint64_t pack(uint64_t key, int evaluation) noexcept {
+        return (key & KEY_MASK) | static_cast<uint32_t>(evaluation);
+    }
+
+public:
+    EvaluationCache() { setSize(DEFAULT_EVAL_CACHE_SIZE); }
+
+    [[nodiscard]] std::optional<int> probe(uint64_t key) const {
+        ++thread_search_statistics.eval_cache_probes;
+        const uint64_t word = std::atomic_ref(table_[key & mask_]).load(std::memory_order_relaxed);
+        if (word == 0 || (word & KEY_MASK) != (key & KEY_MASK)) {
+            return std::nullopt;
+        }
+        ++thread_search_statistics.eval_cache_hits;
+        return static_cast<int32_t>(static_cast<uint32_t>(word));
+    }
+
+    void store(uint64_t key, int evaluation) {
+        std::atomic_ref(table_[key & mask_]).store(pack(key, evaluation), std::memory_order_relaxed);
+    }
+
+    void setMBSize(size_t size) {
+        constexpr std::size_t BYTES_PER_MEGABYTE = 1024ULL * 1024ULL;
+        setSize(size * BYTES_PER_MEGABYTE / sizeof(uint64_t));
+    }
+
+    // Size in entries, rounded up to a power of 2.
+    void setSize(size_t size) {
+        const size_t pow2 = std::bit_ceil(std::max<size_t>(size, 1));
+        memory_           = LargePageBuffer(pow2 * sizeof(uint64_t));
+        table_            = static_cast<uint64_t*>(memory_.data());
+        entry_count_      = pow2;
+        mask_             = pow2 - 1;
+        clear();
+    }
+
+    // Evaluations depend only on the position, so clearing is never needed for correctness.
+    void clear() { std::memset(table_, 0, entry_count_ * sizeof(uint64_t)); }
+
+    [[nodiscard]] size_t getEntryCount() const { return entry_count_; }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_EVALUATION_CACHE_HPP
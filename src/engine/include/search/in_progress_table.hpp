@@ -0,0 +1,75 @@
+#ifndef BITCRUSHER_IN_PROGRESS_TABLE_HPP
+#define BITCRUSHER_IN_PROGRESS_TABLE_HPP
+
+#include "large_page_buffer.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace bitcrusher {
+
+inline constexpr std::size_t IN_PROGRESS_BUCKETS = 1024; // Must be a power of 2.
+inline constexpr int         IN_PROGRESS_WAYS    = CACHE_LINE_SIZE / sizeof(uint64_t);
+
+/// @brief Positions some thread is currently searching, for ABDADA-style move deferral.
+///
+/// A small fixed-size table (64 KB) that stays in cache regardless of the transposition table
+/// size. Each bucket is one cache line holding a few Zobrist keys, so a lookup touches a single
+/// line. A thread entering a node claims an empty way with a CAS and clears it on leaving; when
+/// every way is taken the node is simply not marked, which only costs a missed deferral.
+class InProgressTable {
+    struct alignas(CACHE_LINE_SIZE) Bucket {
+        std::array<std::atomic<uint64_t>, IN_PROGRESS_WAYS> keys{};
+    };
+
+    std::array<Bucket, IN_PROGRESS_BUCKETS> buckets_{};
+
+    [[nodiscard]] Bucket& bucketFor(uint64_t key) {
+        return buckets_[key & (IN_PROGRESS_BUCKETS - 1)];
+    }
+
+    [[nodiscard]] const Bucket& bucketFor(uint64_t key) const {
+        return buckets_[key & (IN_PROGRESS_BUCKETS - 1)];
+    }
+
+public:
+    // Marks the position as being searched. Returns false if the bucket was full; only a
+    // successful enter() must be paired with leave().
+    bool enter(uint64_t key) {
+        if (key == 0) { // 0 marks an empty way.
+            return false;
+        }
+        for (auto& way : bucketFor(key).keys) {
+            uint64_t expected = 0;
+            if (way.load(std::memory_order_relaxed) == 0 &&
+                way.compare_exchange_strong(expected, key, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Removes one mark of the position; other threads searching it keep theirs.
+    void leave(uint64_t key) {
+        for (auto& way : bucketFor(key).keys) {
+            uint64_t expected = key;
+            if (way.compare_exchange_strong(expected, 0, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] bool contains(uint64_t key) const {
+        for (const auto& way : bucketFor(key).keys) {
+            if (way.load(std::memory_order_relaxed) == key) {
+                return key != 0;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_IN_PROGRESS_TABLE_HPP
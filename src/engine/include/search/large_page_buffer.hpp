@@ -0,0 +1,121 @@
+#ifndef BITCRUSHER_LARGE_PAGE_BUFFER_HPP
+#define BITCRUSHER_LARGE_PAGE_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <utility>
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+namespace bitcrusher {
+
+inline constexpr std::size_t HUGE_PAGE_SIZE  = 2ULL * 1024 * 1024;
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+enum class LargePageStatus : std::uint8_t {
+    NONE,        // Regular pages.
+    TRANSPARENT, // madvise(MADV_HUGEPAGE) accepted, the kernel backs the range with huge pages.
+    HUGETLB,     // Explicit pages from the reserved hugetlbfs pool.
+};
+
+[[nodiscard]] constexpr std::string_view toString(LargePageStatus status) noexcept {
+    switch (status) {
+    case LargePageStatus::TRANSPARENT:
+        return "transparent";
+    case LargePageStatus::HUGETLB:
+        return "hugetlb";
+    default:
+        return "off";
+    }
+}
+
+/// @brief Owning, uninitialised memory block backed by huge pages where the OS allows it.
+///
+/// Large tables probed at random (the transposition table) spend much of their time in TLB
+/// misses on 4 KB pages. On Linux this first tries explicit hugetlbfs pages, then falls back to a
+/// 2 MB aligned block marked with madvise(MADV_HUGEPAGE). Other platforms get a cache-line aligned
+/// block. The memory is not touched here, so the first thread writing a page decides its NUMA node.
+class LargePageBuffer {
+public:
+    LargePageBuffer() = default;
+
+    explicit LargePageBuffer(std::size_t bytes) {
+#if defined(__linux__)
+        if (bytes < HUGE_PAGE_SIZE) { // Not worth a whole huge page.
+            size_ = ((bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+            data_ = ::operator new(size_, std::align_val_t{alignment_});
+            return;
+        }
+        size_      = ((bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+        void* data = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (data != MAP_FAILED) {
+            data_   = data;
+            status_ = LargePageStatus::HUGETLB;
+            return;
+        }
+        alignment_ = HUGE_PAGE_SIZE;
+        data_      = ::operator new(size_, std::align_val_t{alignment_});
+        if (madvise(data_, size_, MADV_HUGEPAGE) == 0) {
+            status_ = LargePageStatus::TRANSPARENT;
+        }
+#else
+        size_ = ((bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+        data_ = ::operator new(size_, std::align_val_t{alignment_});
+#endif
+    }
+
+    LargePageBuffer(const LargePageBuffer&)            = delete;
+    LargePageBuffer& operator=(const LargePageBuffer&) = delete;
+
+    LargePageBuffer(LargePageBuffer&& other) noexcept { swap(other); }
+
+    LargePageBuffer& operator=(LargePageBuffer&& other) noexcept {
+        LargePageBuffer released(std::move(other));
+        swap(released);
+        return *this;
+    }
+
+    ~LargePageBuffer() { release(); }
+
+    [[nodiscard]] void* data() const noexcept { return data_; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] LargePageStatus status() const noexcept { return status_; }
+
+private:
+    void*           data_{nullptr};
+    std::size_t     size_{0};
+    std::size_t     alignment_{CACHE_LINE_SIZE};
+    LargePageStatus status_{LargePageStatus::NONE};
+
+    void swap(LargePageBuffer& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(alignment_, other.alignment_);
+        std::swap(status_, other.status_);
+    }
+
+    void release() noexcept {
+        if (data_ == nullptr) {
+            return;
+        }
+#if defined(__linux__)
+        if (status_ == LargePageStatus::HUGETLB) {
+            munmap(data_, size_);
+            data_ = nullptr;
+            return;
+        }
+#endif
+        ::operator delete(data_, std::align_val_t{alignment_});
+        data_ = nullptr;
+    }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_LARGE_PAGE_BUFFER_HPP
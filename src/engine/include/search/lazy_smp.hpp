@@ -0,0 +1,89 @@
+#ifndef BITCRUSHER_LAZY_SMP_HPP
+#define BITCRUSHER_LAZY_SMP_HPP
+
+#include "move.hpp"
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bitcrusher {
+
+// Lazy SMP: every thread searches the same root and shares the transposition table. Helper
+// threads skip some iterations, so at any time the threads are spread over neighbouring depths
+// instead of all searching the same tree in lockstep.
+
+// Helper i skips its iterations in runs of HELPER_SKIP_SIZE[j] depths, shifted by
+// HELPER_SKIP_PHASE[j], where j = (i - 1) % HELPER_SKIP_PATTERNS. The main thread (index 0)
+// searches every depth.
+inline constexpr int HELPER_SKIP_PATTERNS = 20;
+
+inline constexpr std::array<int, HELPER_SKIP_PATTERNS> HELPER_SKIP_SIZE = {
+    1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+inline constexpr std::array<int, HELPER_SKIP_PATTERNS> HELPER_SKIP_PHASE = {
+    0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+[[nodiscard]] constexpr bool skipsIteration(int thread_index, int depth) noexcept {
+    if (thread_index == 0) {
+        return false;
+    }
+    const int pattern = (thread_index - 1) % HELPER_SKIP_PATTERNS;
+    return ((depth + HELPER_SKIP_PHASE[pattern]) / HELPER_SKIP_SIZE[pattern]) % 2 != 0;
+}
+
+// Added to every score above the lowest one, so the worst scored move still gets votes.
+inline constexpr int VOTE_SCORE_OFFSET = 14;
+
+// The last iteration a search thread completed. best_move may come from a later, unfinished
+// iteration that had already found a better move.
+struct ThreadResult {
+    Move              best_move{Move::none()};
+    int               depth{0};
+    int               score{0};
+    std::vector<Move> principal_variation;
+};
+
+/// @brief Index of the result whose move is played. Every thread votes for its best move with a
+/// weight growing with its depth and with how far its score is above the lowest one. The first
+/// result, the main thread's, wins ties.
+[[nodiscard]] inline std::size_t pickVotedResult(std::span<const ThreadResult> results) {
+    const auto votes_cast = [](const ThreadResult& result) {
+        return result.depth > 0 && result.best_move != Move::none();
+    };
+    int min_score = INT_MAX;
+    for (const ThreadResult& result : results) {
+        if (votes_cast(result)) {
+            min_score = std::min(min_score, result.score);
+        }
+    }
+    const auto votes_for = [&](const Move& move) {
+        int64_t votes = 0;
+        for (const ThreadResult& result : results) {
+            if (votes_cast(result) && result.best_move == move) {
+                votes += static_cast<int64_t>(result.score - min_score + VOTE_SCORE_OFFSET) *
+                         result.depth;
+            }
+        }
+        return votes;
+    };
+
+    std::size_t best       = 0;
+    int64_t     best_votes = results.empty() ? 0 : votes_for(results[0].best_move);
+    for (std::size_t i = 1; i < results.size(); ++i) {
+        if (! votes_cast(results[i])) {
+            continue;
+        }
+        const int64_t votes = votes_for(results[i].best_move);
+        if (votes > best_votes) {
+            best       = i;
+            best_votes = votes;
+        }
+    }
+    return best;
+}
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_LAZY_SMP_HPP
@@ -0,0 +1,234 @@
+#ifndef BITCRUSHER_MOVE_PICKER_HPP
+#define BITCRUSHER_MOVE_PICKER_HPP
+
+#include "bitboard_enums.hpp"
+#include "board_state.hpp"
+#include "concepts.hpp"
+#include "heuristics/heuristics.hpp"
+#include "legal_move_generators/legal_moves_generator.hpp"
+#include "legal_move_generators/shared_move_generation.hpp"
+#include "move.hpp"
+#include "move_sink.hpp"
+#include "restriction_context.hpp"
+#include "search_statistics.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+namespace bitcrusher {
+
+// Forwards moves to a sink without clearing the moves already generated at the ply, so a later
+// generation stage appends to an earlier one.
+template <MoveSink MoveSinkT>
+struct AppendingMoveSink : MoveSinkBase<AppendingMoveSink<MoveSinkT>> {
+    MoveSinkT& sink;
+
+    explicit AppendingMoveSink(MoveSinkT& target) : sink(target) {}
+
+    template <MoveType  MoveT,
+              PieceType MovedOrPromotedToPiece,
+              Color     SideToMove,
+              PieceType CapturedPiece = PieceType::NONE>
+    void emplace(Square from, Square to) noexcept {
+        sink.template emplace<MoveT, MovedOrPromotedToPiece, SideToMove, CapturedPiece>(from, to);
+    }
+
+    void setPly(int ply) { sink.ply = ply; }
+};
+
+enum class PickerStage : std::uint8_t {
+    TT_MOVE,
+    GOOD_CAPTURES,
+    QUIETS,
+    BAD_CAPTURES,
+    DONE,
+};
+
+/// @brief Hands out the moves of a main search node in stages: the TT move, captures that do not
+/// lose material (MVV-LVA), quiet moves (promotions, killers, countermove, then by history) and
+/// finally losing captures. Within a stage the best scored remaining move is picked each time.
+///
+/// Captures and quiet moves are generated separately and quiet moves only once the captures are
+/// exhausted, so a node cut off by the TT move or a capture never generates them. Quiet moves
+/// are still generated before a quiet TT move is tried, as the generators are the only check of
+/// its legality.
+///
+/// The n-th move returned is stored at sink.moves[ply][n], so once next() has returned
+/// std::nullopt the ply holds every legal move in the order they were picked.
+template <SearchConfig Config, Color Side, MoveSink MoveSinkT> class MovePicker {
+public:
+    /// @brief Generates the captures of the position, which also updates restriction_context.
+    MovePicker(const BoardState&                   board,
+               MoveSinkT&                          sink,
+               RestrictionContext&                 restriction_context,
+               int                                 ply,
+               PackedMove                          tt_move,
+               const heuristics::QuietMoveHistory& history,
+               const Move&                         previous_move)
+        : board_(board), sink_(sink), restriction_context_(restriction_context), ply_(ply),
+          tt_move_(Config.tt_move_ordering.enabled ? tt_move : PACKED_MOVE_NONE),
+          history_(history), previous_move_(previous_move) {
+        generateCaptures();
+    }
+
+    /// @brief Starts again from the TT move after another search of the same position at this
+    /// ply, like a singular extension verification search, replaced the ply's moves.
+    void restart() {
+        stage_                = PickerStage::TT_MOVE;
+        cursor_               = 0;
+        losing_capture_count_ = 0;
+        quiets_generated_     = false;
+        generateCaptures();
+    }
+
+    /// @brief Whether the side to move has a legal move. Generates the quiet moves only when
+    /// there is no capture.
+    [[nodiscard]] bool hasLegalMoves() {
+        if (count() == 0) {
+            generateQuiets();
+        }
+        return count() > 0;
+    }
+
+    /// @brief Generates every remaining stage up front, for nodes that need the whole move list.
+    void generateAll() { generateQuiets(); }
+
+    [[nodiscard]] std::optional<Move> next() {
+        switch (stage_) {
+        case PickerStage::TT_MOVE:
+            stage_ = PickerStage::GOOD_CAPTURES;
+            if (tt_move_ != PACKED_MOVE_NONE && pickTTMove()) {
+                ++cursor_;
+                scoreCaptures();
+                return moves()[0];
+            }
+            scoreCaptures();
+            [[fallthrough]];
+        case PickerStage::GOOD_CAPTURES:
+            while (cursor_ < captures_end_) {
+                heuristics::pickBest(sink_, ply_, cursor_, captures_end_);
+                if constexpr (Config.static_exchange.capture_ordering) {
+                    if (heuristics::isLosingCapture<Side>(board_, moves()[cursor_])) {
+                        deferLosingCapture();
+                        continue;
+                    }
+                }
+                return moves()[cursor_++];
+            }
+            stage_ = PickerStage::QUIETS;
+            generateQuiets();
+            scoreQuiets();
+            [[fallthrough]];
+        case PickerStage::QUIETS:
+            if (cursor_ < count()) {
+                heuristics::pickBest(sink_, ply_, cursor_, count());
+                return moves()[cursor_++];
+            }
+            stage_ = PickerStage::BAD_CAPTURES;
+            for (int i = 0; i < losing_capture_count_; ++i) {
+                moves()[sink_.count[ply_]++] = moves()[MAX_LEGAL_MOVES - 1 - i];
+            }
+            [[fallthrough]];
+        case PickerStage::BAD_CAPTURES:
+            if (cursor_ < count()) {
+                return moves()[cursor_++];
+            }
+            stage_ = PickerStage::DONE;
+            [[fallthrough]];
+        case PickerStage::DONE:
+            break;
+        }
+        return std::nullopt;
+    }
+
+private:
+    [[nodiscard]] Move* moves() { return sink_.moves[ply_].data(); }
+
+    [[nodiscard]] int count() const { return sink_.count[ply_]; }
+
+    void generateCaptures() {
+        generateLegalMoves<Side, MoveGenerationPolicy::COMPETITIVE_CAPTURES_ONLY>(
+            board_, sink_, restriction_context_, ply_);
+        captures_end_ = count();
+    }
+
+    void generateQuiets() {
+        if (quiets_generated_) {
+            return;
+        }
+        quiets_generated_ = true;
+        // Searching earlier moves reused restriction_context for other positions.
+        AppendingMoveSink<MoveSinkT> appending_sink{sink_};
+        generateLegalMoves<Side, MoveGenerationPolicy::COMPETITIVE_QUIETS_ONLY>(
+            board_, appending_sink, restriction_context_, ply_);
+    }
+
+    // Moves the TT move to the front if it is legal here, generating quiet moves if it is not a
+    // capture.
+    [[nodiscard]] bool pickTTMove() {
+        const auto find_tt_move = [&](int begin, int end) {
+            return std::find_if(moves() + begin, moves() + end,
+                                [&](const Move& move) { return packMove(move) == tt_move_; });
+        };
+        Move* found = find_tt_move(0, captures_end_);
+        if (found == moves() + captures_end_) {
+            // The quiet moves follow the captures, even when they were generated earlier.
+            generateQuiets();
+            found = find_tt_move(captures_end_, count());
+            if (found == moves() + count()) {
+                // Anything else came from another position.
+                ++thread_search_statistics.tt_collisions;
+                return false;
+            }
+            ++captures_end_; // The captures move one place back.
+        }
+        std::rotate(moves(), found, found + 1);
+        return true;
+    }
+
+    void scoreCaptures() {
+        for (int i = cursor_; i < captures_end_; ++i) {
+            sink_.scores[ply_][i] = heuristics::scoreCapture<Config>(moves()[i]);
+        }
+    }
+
+    void scoreQuiets() {
+        const Move countermove = history_.countermoves.get<Side>(previous_move_);
+        for (int i = cursor_; i < count(); ++i) {
+            sink_.scores[ply_][i] =
+                heuristics::scoreQuiet<Config, Side>(moves()[i], history_, ply_, countermove);
+        }
+    }
+
+    // Takes the capture at the cursor out of the ply until every other move was picked. Deferred
+    // captures are kept at the back of the ply's array, which the legal moves never reach. The
+    // last remaining capture and the last quiet move, if any were generated, fill the gap.
+    void deferLosingCapture() {
+        const Move losing_capture = moves()[cursor_];
+
+        moves()[cursor_]            = moves()[captures_end_ - 1];
+        sink_.scores[ply_][cursor_] = sink_.scores[ply_][captures_end_ - 1];
+        moves()[captures_end_ - 1]  = moves()[count() - 1];
+        --captures_end_;
+        --sink_.count[ply_];
+        moves()[MAX_LEGAL_MOVES - 1 - losing_capture_count_++] = losing_capture;
+    }
+
+    const BoardState&                   board_;
+    MoveSinkT&                          sink_;
+    RestrictionContext&                 restriction_context_;
+    int                                 ply_;
+    PackedMove                          tt_move_;
+    const heuristics::QuietMoveHistory& history_;
+    Move                                previous_move_;
+
+    PickerStage stage_                = PickerStage::TT_MOVE;
+    int         cursor_               = 0; // Index of the next move to hand out.
+    int         captures_end_         = 0;
+    int         losing_capture_count_ = 0;
+    bool        quiets_generated_     = false;
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_MOVE_PICKER_HPP
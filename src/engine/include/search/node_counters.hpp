@@ -0,0 +1,67 @@
+#ifndef BITCRUSHER_NODE_COUNTERS_HPP
+#define BITCRUSHER_NODE_COUNTERS_HPP
+
+#include "large_page_buffer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace bitcrusher {
+
+// Index of the calling search thread into NodeCounters: 0 for the main thread, and for searches
+// run directly, 1 and up for helpers.
+inline thread_local int search_thread_index = 0;
+
+/// @brief Nodes searched, one counter per search thread.
+///
+/// Each counter has a cache line to itself and only its own thread writes it, so counting a node
+/// is a plain load and store that never bounces a line between cores. Readers sum the counters
+/// on demand; a total read during a search may miss the last few increments of each thread.
+class NodeCounters {
+    struct alignas(CACHE_LINE_SIZE) Counter {
+        std::atomic<uint64_t> nodes{0};
+    };
+
+    std::unique_ptr<Counter[]> counters_;
+    int                        thread_count_{0};
+
+public:
+    explicit NodeCounters(int thread_count = 1) { resize(thread_count); }
+
+    // Drops every count. Must not be called while a search is running.
+    void resize(int thread_count) {
+        thread_count_ = std::max(thread_count, 1);
+        counters_     = std::make_unique<Counter[]>(thread_count_);
+    }
+
+    void reset() noexcept {
+        for (int i = 0; i < thread_count_; ++i) {
+            counters_[i].nodes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Called by the thread owning the counter only.
+    void increment(int thread_index) noexcept {
+        std::atomic<uint64_t>& nodes = counters_[thread_index].nodes;
+        nodes.store(nodes.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t threadNodes(int thread_index) const noexcept {
+        return counters_[thread_index].nodes.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t total() const noexcept {
+        uint64_t total = 0;
+        for (int i = 0; i < thread_count_; ++i) {
+            total += counters_[i].nodes.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    [[nodiscard]] int threadCount() const noexcept { return thread_count_; }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_NODE_COUNTERS_HPP
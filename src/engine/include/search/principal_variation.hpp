@@ -0,0 +1,53 @@
+#ifndef BITCRUSHER_PRINCIPAL_VARIATION_HPP
+#define BITCRUSHER_PRINCIPAL_VARIATION_HPP
+
+#include "move.hpp"
+#include "move_sink.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <span>
+
+namespace bitcrusher {
+
+/// @brief Triangular principal variation table, filled by search() as it runs.
+///
+/// Row ply holds the best line found so far from the node at that ply, stored at indices
+/// [ply, length(ply)). A node empties its row on entry and, whenever a move raises alpha, copies
+/// that move followed by the child's row. After an iteration row 0 is the line behind the root
+/// score, with no transposition table lookups needed to recover it.
+class PrincipalVariationTable {
+    std::array<std::array<Move, MAX_PLY + 1>, MAX_PLY + 1> moves_{};
+    std::array<int, MAX_PLY + 1>                           length_{};
+
+public:
+    void clear(int ply) noexcept {
+        assert(ply <= MAX_PLY);
+        length_[ply] = ply;
+    }
+
+    // The child at ply + 1 must have been searched (and so cleared its row) before this call.
+    void update(int ply, const Move& move) noexcept {
+        assert(ply < MAX_PLY);
+        const int child_end = std::max(length_[ply + 1], ply + 1);
+        moves_[ply][ply]    = move;
+        std::copy(moves_[ply + 1].begin() + ply + 1, moves_[ply + 1].begin() + child_end,
+                  moves_[ply].begin() + ply + 1);
+        length_[ply] = child_end;
+    }
+
+    // Replaces the row with a line found by another thread, starting with the move at ply.
+    void assign(int ply, std::span<const Move> line) noexcept {
+        assert(ply + static_cast<int>(line.size()) <= MAX_PLY + 1);
+        std::copy(line.begin(), line.end(), moves_[ply].begin() + ply);
+        length_[ply] = ply + static_cast<int>(line.size());
+    }
+
+    [[nodiscard]] std::span<const Move> line(int ply = 0) const noexcept {
+        return {moves_[ply].begin() + ply, moves_[ply].begin() + length_[ply]};
+    }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_PRINCIPAL_VARIATION_HPP
@@ -4,30 +4,52 @@
 #include "board_state.hpp"
 #include "concepts.hpp"
 #include "evaluation.hpp"
+#include "evaluation_cache.hpp"
 #include "heuristics/heuristics.hpp"
+#include "in_progress_table.hpp"
 #include "legal_move_generators/legal_moves_generator.hpp"
 #include "legal_move_generators/shared_move_generation.hpp"
 #include "move.hpp"
+#include "move_picker.hpp"
 #include "move_processor.hpp"
+#include "node_counters.hpp"
+#include "principal_variation.hpp"
 #include "restriction_context.hpp"
+#include "search_statistics.hpp"
+#include "split_point.hpp"
 #include "transposition_table.hpp"
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdlib>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <thread>
 #include <unordered_set>
-#include <vector>
 
 namespace bitcrusher {
 
 inline constexpr int SEARCH_INTERRUPTED  = 987654321;
-inline constexpr int CHECKMATE_BASE      = 1000000;
-inline constexpr int CHECKMATE_THRESHOLD = CHECKMATE_BASE - 1000;
 inline constexpr int NODE_CHECK_INTERVAL = 1023;
 
+// Iterations from this depth on search a window of +-ASPIRATION_WINDOW around the previous
+// score, doubled on every fail-low or fail-high.
+inline constexpr int ASPIRATION_MIN_DEPTH = 4;
+inline constexpr int ASPIRATION_WINDOW    = 25;
+
+// What a reported root score is: exact, or a bound from a failed aspiration window.
+enum class ScoreBound : std::uint8_t { EXACT, LOWER, UPPER };
+
+// Transposition table depths of quiescence results, below any main search depth.
+inline constexpr int QUIESCENCE_CHECK_DEPTH = 0;
+inline constexpr int QUIESCENCE_DEPTH       = -1;
+
 struct SearchParameters {
     bool ponder{false};
     int  white_time_ms{0};
@@ -35,7 +57,7 @@ struct SearchParameters {
     int  white_increment_ms{0};
     int  black_increment_ms{0};
     int  moves_to_go{0};  // Number of moves till next time control.
-    int  max_ply{300};    // Search max depth.
+    int  max_ply{300};    // Search max depth in plies.
     int  max_nodes{-1};   // Search x nodes only.
     int  mate_in_x{0};    // Search fo a mate in x moves.
     int  move_time_ms{0}; // Search x mseconds.
@@ -48,31 +70,73 @@ struct SearchParameters {
 };
 
 struct SharedSearchContext {
-    std::atomic<std::uint64_t> nodes_searched{0ULL};
+    NodeCounters               nodes_searched;
     TranspositionTable         tt;
+    EvaluationCache            eval_cache;
+    InProgressTable            in_progress; // Nodes being searched, for deferring moves.
+    SplitPointQueue            split_points; // Nodes whose moves YBWC helpers may join.
 
     std::atomic<bool>    is_pondering{false};
     std::atomic<int64_t> time_limit_start_ms{0};
     std::atomic<int>     max_search_time_ms{0};
 
-    // Best move found at the root so far. Written only by the main thread
-    // (IsRoot=true). Guarantees a legal move is always available even if
+    // Totals of every thread's SearchStatistics, merged after each iteration.
+    std::mutex       statistics_mutex;
+    SearchStatistics statistics;
+};
+
+// State owned by a single search thread.
+struct ThreadSearchContext {
+    PrincipalVariationTable       pv;
+    std::array<bool, MAX_PLY + 1> null_move_at_ply{}; // Set while a null move is searched.
+    std::array<Move, MAX_PLY + 1> move_at_ply{};      // Move being searched, Move::none() for null.
+    std::array<int, MAX_PLY + 1>  line_extensions{};  // Plies the line to each ply was extended by.
+    heuristics::QuietMoveHistory  quiet_history;
+
+    // Best move found at the root so far. Guarantees a legal move is always available even if
     // iterative deepening is interrupted before depth 1 completes.
     Move root_best_move{Move::none()};
+};
 
-#ifdef DEBUG
-    std::atomic<int> beta_cutoffs{0};
-    std::atomic<int> tt_cutoffs{0};
-#endif
+// Search state of a YBWC helper thread, reused for every split point it joins.
+struct SplitWorker {
+    std::unique_ptr<ThreadSearchContext> thread_ctx = std::make_unique<ThreadSearchContext>();
+    std::unique_ptr<FastMoveSink>        sink       = std::make_unique<FastMoveSink>();
+    RestrictionContext                   restriction_context;
 };
 
+// Adds the calling thread's counters to the search totals and starts them again from zero.
+inline void mergeThreadStatistics(SharedSearchContext& search_ctx) {
+    const std::lock_guard<std::mutex> lock(search_ctx.statistics_mutex);
+    search_ctx.statistics += thread_search_statistics;
+    thread_search_statistics = {};
+}
+
+// Static evaluation for the side to move, computed once per position across all threads.
+template <Color Side, typename CtxT>
+int cachedEval(CtxT& search_ctx, const BoardState& board) {
+    const uint64_t key = board.getZobristHash();
+    if (const std::optional<int> cached = search_ctx.eval_cache.probe(key)) {
+        return *cached;
+    }
+    const int evaluation = eval(board, Side);
+    search_ctx.eval_cache.store(key, evaluation);
+    return evaluation;
+}
+
+// Scores that carry no evaluation and must be passed up instead of compared with the window.
+[[nodiscard]] constexpr bool isAbortScore(int score) noexcept {
+    return abs(score) == SEARCH_INTERRUPTED || abs(score) == ON_EVALUATION;
+}
+
 template <typename CtxT>
 inline bool shouldStopSearching(const std::stop_token& st, CtxT& search_ctx) {
     if (st.stop_requested()) {
         return true;
     }
 
-    if ((search_ctx.nodes_searched.load() & NODE_CHECK_INTERVAL) == 0 &&
+    // Each thread checks the clock by its own count, read from a line no other thread writes.
+    if ((search_ctx.nodes_searched.threadNodes(search_thread_index) & NODE_CHECK_INTERVAL) == 0 &&
         ! search_ctx.is_pondering.load()) {
         auto now = std::chrono::steady_clock::now();
         auto current_time_ms =
@@ -105,12 +169,37 @@ int quiescenceSearch(CtxT&                  search_ctx,
     if (shouldStopSearching(st, search_ctx)) {
         return SEARCH_INTERRUPTED;
     }
-    search_ctx.nodes_searched.fetch_add(1, std::memory_order::relaxed);
+    if (ply >= MAX_PLY - 1) {
+        return cachedEval<Side>(search_ctx, board); // No room left in the move sink.
+    }
+    search_ctx.nodes_searched.increment(search_thread_index);
 
     updateRestrictionContext<Side>(board, restriction_context);
 
+    const bool in_check   = restriction_context.check_count > 0;
+    const int  alpha_orig = alpha;
+
+    // Transposition table. Entries are stored at depth 0 when in check (every evasion is searched)
+    // and -1 otherwise, so main search entries are always deep enough to cut off here.
+    const uint64_t          zobrist_key = board.getZobristHash();
+    const int               tt_depth    = in_check ? QUIESCENCE_CHECK_DEPTH : QUIESCENCE_DEPTH;
+    TranspositionTableEntry stored_entry;
+    if constexpr (Config.quiescence.use_transposition_table) {
+        stored_entry = search_ctx.tt.getEntry(zobrist_key, ply);
+        if (stored_entry.found() && stored_entry.depth >= tt_depth) {
+            if (stored_entry.evaluation_type == TranspositionTableEvaluationType::EXACT_VALUE ||
+                (stored_entry.evaluation_type == TranspositionTableEvaluationType::LOWERBOUND &&
+                 stored_entry.value >= beta) ||
+                (stored_entry.evaluation_type == TranspositionTableEvaluationType::UPPERBOUND &&
+                 stored_entry.value <= alpha)) {
+                ++thread_search_statistics.tt_cutoffs;
+                return stored_entry.value;
+            }
+        }
+    }
+
     // Generate appropriate moves based on check state.
-    if (restriction_context.check_count > 0) { // In check.
+    if (in_check) {
         generateLegalMoves<Side, MoveGenerationPolicy::COMPETITIVE_FULL,
                            RestrictionContextUpdatePolicy::LEAVE>(board, sink, restriction_context,
                                                                   ply);
@@ -123,7 +212,9 @@ int quiescenceSearch(CtxT&                  search_ctx,
                                                                   ply);
     }
 
-    int static_eval = eval(board, Side);
+    int static_eval = stored_entry.static_eval != TT_NO_EVAL
+                          ? stored_entry.static_eval
+                          : cachedEval<Side>(search_ctx, board);
 
     if (sink.count[ply] == 0) { // No legal captures or max depth.
         return static_eval;
@@ -133,14 +224,32 @@ int quiescenceSearch(CtxT&                  search_ctx,
 
     // Stand pat.
     if (best_score >= beta) {
+        if constexpr (Config.quiescence.use_transposition_table) {
+            search_ctx.tt.store(zobrist_key, best_score, PACKED_MOVE_NONE, tt_depth,
+                                TranspositionTableEvaluationType::LOWERBOUND, ply, static_eval);
+        }
         return best_score;
     }
     alpha = std::max(best_score, alpha);
 
-    heuristics::scoreAndSortQuiescence<Config>(sink, ply);
+    heuristics::scoreQuiescenceMoves<Config>(sink, stored_entry.best_move, ply);
 
+    Move best_move = Move::none();
     for (int i = 0; i < sink.count[ply]; i++) {
+        heuristics::pickBest(sink, ply, i, sink.count[ply]);
         Move move = sink.moves[ply][i];
+        if constexpr (Config.static_exchange.quiescence_pruning) {
+            // Losing captures are skipped, except when they are needed to get out of check.
+            if (! in_check && move.isCapture() && heuristics::isLosingCapture<Side>(board, move)) {
+                continue;
+            }
+        }
+        if constexpr (Config.delta_pruning.enabled) {
+            if (! in_check &&
+                static_eval + heuristics::materialGain(move) + heuristics::DELTA_MARGIN <= alpha) {
+                continue;
+            }
+        }
         move_processor.applyMove(board, move);
 
         assert((board.getOwnOccupancy<Side>() ^ board.getOpponentOccupancy<Side>()) ==
@@ -156,17 +265,20 @@ int quiescenceSearch(CtxT&                  search_ctx,
         }
         if (score > best_score) {
             best_score = score;
+            best_move  = move;
             alpha      = std::max(score, alpha);
         }
         if (alpha >= beta) {
             break; // Beta cutoff.
         }
     }
+    if constexpr (Config.quiescence.use_transposition_table) {
+        search_ctx.tt.storeBounded(zobrist_key, best_score, best_move, tt_depth, alpha_orig, beta,
+                                   ply, static_eval);
+    }
     return best_score;
 }
 
-/// @brief Alpha is minimum score that the maximizing player is assured of.
-/// Beta is maximum score that the minimizing player is assured of.
 template <Color        Side,
           SearchConfig Config             = DEFAULT_CONFIG,
           bool         IsRoot             = false,
@@ -174,6 +286,7 @@ template <Color        Side,
           MoveSink     MoveSinkT,
           typename CtxT>
 int search(CtxT&                   search_ctx,
+           ThreadSearchContext&    thread_ctx,
            BoardState&             board,
            MoveProcessor&          move_processor,
            const SearchParameters& search_parameters,
@@ -183,8 +296,150 @@ int search(CtxT&                   search_ctx,
            int                     beta,
            std::stop_token&        st,
            MoveSinkT&              sink,
-           int                     ply       = 0,
-           bool                    exclusive = false) {
+           int                     ply           = 0,
+           bool                    exclusive     = false,
+           PackedMove              excluded_move = PACKED_MOVE_NONE);
+
+// Plies a late quiet move is first searched shallower by.
+template <SearchConfig Config>
+[[nodiscard]] int lateMoveReductionOf(
+    const Move& move, int move_index, int depth, bool pv_node, bool in_check) noexcept {
+    if constexpr (Config.late_move_reductions.enabled) {
+        if (depth >= heuristics::LMR_MIN_DEPTH && move_index >= heuristics::LMR_MIN_MOVE_INDEX &&
+            ! in_check && ! move.isCapture() && ! move.isPromotion()) {
+            return heuristics::lateMoveReduction(depth, move_index, pv_node);
+        }
+    }
+    return 0;
+}
+
+/// @brief Score of a move already made on board, for the side that made it. Every move but the
+/// first is searched with a zero window first, reduced if it is a late quiet move, and searched
+/// again at full depth and with the full window only if it beats alpha.
+template <Color Side, SearchConfig Config, MoveSink MoveSinkT, typename CtxT>
+int searchMadeMove(CtxT&                   search_ctx,
+                   ThreadSearchContext&    thread_ctx,
+                   BoardState&             board,
+                   MoveProcessor&          move_processor,
+                   const SearchParameters& search_parameters,
+                   RestrictionContext&     restriction_context,
+                   std::stop_token&        st,
+                   MoveSinkT&              sink,
+                   int                     ply,
+                   int                     new_depth,
+                   int                     reduction,
+                   int                     alpha,
+                   int                     beta,
+                   bool                    first_move,
+                   bool                    exclusive) {
+    auto search_child = [&](int child_depth, int child_alpha, int child_beta,
+                            bool child_exclusive) {
+        return -search<! Side, Config>(search_ctx, thread_ctx, board, move_processor,
+                                       search_parameters, restriction_context, child_depth,
+                                       -child_beta, -child_alpha, st, sink, ply + 1,
+                                       child_exclusive);
+    };
+
+    int  score       = 0;
+    bool full_window = first_move;
+    if (! full_window && (reduction > 0 || Config.principal_variation_search.enabled)) {
+        // Zero window: only proves whether the move beats alpha.
+        score = search_child(new_depth - reduction, alpha, alpha + 1, exclusive);
+        if (reduction > 0 && Config.principal_variation_search.enabled && ! isAbortScore(score) &&
+            score > alpha) {
+            score = search_child(new_depth, alpha, alpha + 1, false);
+        }
+        full_window = ! isAbortScore(score) && score > alpha &&
+                      (score < beta || ! Config.principal_variation_search.enabled);
+        exclusive   = false;
+    } else {
+        full_window = true;
+    }
+    if (full_window) {
+        score = search_child(new_depth, alpha, beta, exclusive);
+    }
+    return score;
+}
+
+/// @brief Searches moves of a split point until none is left, on the calling thread's board and
+/// with its state. The split point keeps the best score; this thread's history learns from a
+/// cutoff it finds.
+template <Color Side, SearchConfig Config, MoveSink MoveSinkT, typename CtxT>
+void searchSplitPointMoves(SplitPoint&          split,
+                           CtxT&                search_ctx,
+                           ThreadSearchContext& thread_ctx,
+                           BoardState&          board,
+                           MoveProcessor&       move_processor,
+                           RestrictionContext&  restriction_context,
+                           MoveSinkT&           sink) {
+    std::stop_token st  = split.stop.get_token();
+    const int       ply = split.ply;
+    while (const std::optional<SplitMove> next = split.takeMove()) {
+        const Move& move      = next->move;
+        const int   extension = packMove(move) == split.extended_move ? 1 : 0;
+        const int   reduction = lateMoveReductionOf<Config>(move, next->index, split.depth,
+                                                          split.pv_node, split.in_check);
+
+        thread_ctx.null_move_at_ply[ply]    = false;
+        thread_ctx.move_at_ply[ply]         = move;
+        thread_ctx.line_extensions[ply + 1] = split.line_extensions + extension;
+        move_processor.applyMove(board, move);
+        search_ctx.tt.prefetch(board.getZobristHash());
+        const int score = searchMadeMove<Side, Config>(
+            search_ctx, thread_ctx, board, move_processor, *split.search_parameters,
+            restriction_context, st, sink, ply, split.depth - 1 + extension, reduction,
+            next->alpha, split.beta, false, false);
+        move_processor.undoMove(board, move);
+
+        if (abs(score) == SEARCH_INTERRUPTED) {
+            split.markInterrupted();
+            return;
+        }
+        if (split.report(move, score, thread_ctx.pv.line(ply + 1))) {
+            ++thread_search_statistics.beta_cutoffs;
+            if (! move.isCapture() && ! move.isPromotion()) {
+                heuristics::updateQuietMoveHistory<Config, Side>(
+                    thread_ctx.quiet_history, ply, split.depth, move, split.previous_move, {});
+            }
+        }
+    }
+}
+
+// Entry point of a helper joining a split point, from a copy of the split position.
+template <Color Side, SearchConfig Config, typename CtxT>
+void joinSplitPoint(SplitPoint& split, SplitWorker& worker) {
+    BoardState    board          = split.board;
+    MoveProcessor move_processor = split.move_processor;
+    searchSplitPointMoves<Side, Config>(split, *static_cast<CtxT*>(split.search_ctx),
+                                        *worker.thread_ctx, board, move_processor,
+                                        worker.restriction_context, *worker.sink);
+}
+
+/// @brief Alpha is minimum score that the maximizing player is assured of.
+/// Beta is maximum score that the minimizing player is assured of.
+/// A node with an excluded_move is a singular extension verification search of the position: it
+/// searches every move except that one and neither cuts off on nor stores to the TT entry.
+template <Color        Side,
+          SearchConfig Config,
+          bool         IsRoot,
+          bool         PauseAfterRootSort,
+          MoveSink     MoveSinkT,
+          typename CtxT>
+int search(CtxT&                   search_ctx,
+           ThreadSearchContext&    thread_ctx,
+           BoardState&             board,
+           MoveProcessor&          move_processor,
+           const SearchParameters& search_parameters,
+           RestrictionContext&     restriction_context,
+           int                     depth,
+           int                     alpha,
+           int                     beta,
+           std::stop_token&        st,
+           MoveSinkT&              sink,
+           int                     ply,
+           bool                    exclusive,
+           PackedMove              excluded_move) {
+    thread_ctx.pv.clear(ply);
     int alpha_orig = alpha;
     if constexpr (IsRoot) {
         if (move_processor.hasCurrentPositionRepeated3Times()) {
@@ -198,6 +453,9 @@ int search(CtxT&                   search_ctx,
     if (board.getHalfmoveClock() >= 100) {
         return 0; // Fifty-move rule draw.
     }
+    if (ply >= MAX_PLY - 1) {
+        return cachedEval<Side>(search_ctx, board); // No room left in the move sink.
+    }
 
     // For the test hook path (IsRoot && PauseAfterRootSort), skip the early stop
     // check so root moves are always generated and sorted before stopping.
@@ -208,44 +466,32 @@ int search(CtxT&                   search_ctx,
     }
 
     // Transposition table cutoff.
+    // The root never cuts off: its TT move is only a packed move, while the root must always
+    // leave a full legal move in root_best_move. The TT move is still searched first.
     uint64_t                zobrist_key  = board.getZobristHash();
-    TranspositionTableEntry stored_entry = search_ctx.tt.getEntry(zobrist_key);
-    if (stored_entry.key == zobrist_key && search_ctx.tt.isSearched(zobrist_key) && exclusive) {
+    TranspositionTableEntry stored_entry = search_ctx.tt.getEntry(zobrist_key, ply);
+    if (stored_entry.found() && exclusive && search_ctx.in_progress.contains(zobrist_key)) {
         return ON_EVALUATION;
     }
-    if (stored_entry.key == zobrist_key && stored_entry.depth >= depth) {
-        // At root, only cut off when the TT move is valid (piece on from-square).
-        // An invalid move signals a hash collision: fall through to the full search so
-        // root_best_move is always set to a legal move rather than Move::none().
-        bool do_tt_cutoff = true;
-        if constexpr (IsRoot) {
-            bool tt_move_valid = ! stored_entry.best_move.isNullMove() &&
-                                 (board.getOwnOccupancy<Side>() &
-                                  (1ULL << static_cast<int>(stored_entry.best_move.fromSquare())));
-            if (tt_move_valid && search_parameters.search_moves.empty()) {
-                search_ctx.root_best_move = stored_entry.best_move;
-            }
-            do_tt_cutoff = tt_move_valid;
-        }
-        if (do_tt_cutoff) {
+    // With PVS, nodes searched with an open window are on the principal variation. They never cut
+    // off either, so the PV table gets the whole line instead of stopping at a table hit.
+    const bool pv_node         = beta - alpha > 1;
+    const bool singular_search = excluded_move != PACKED_MOVE_NONE;
+    if constexpr (! IsRoot) {
+        if (stored_entry.found() && stored_entry.depth >= depth && ! singular_search &&
+            ! (Config.principal_variation_search.enabled && pv_node)) {
             if (stored_entry.evaluation_type == TranspositionTableEvaluationType::EXACT_VALUE) {
-#ifdef DEBUG
-                search_ctx.tt_cutoffs.fetch_add(1, std::memory_order_relaxed);
-#endif
+                ++thread_search_statistics.tt_cutoffs;
                 return stored_entry.value;
             }
             if (stored_entry.evaluation_type == TranspositionTableEvaluationType::LOWERBOUND &&
                 stored_entry.value >= beta) {
-#ifdef DEBUG
-                search_ctx.tt_cutoffs.fetch_add(1, std::memory_order_relaxed);
-#endif
+                ++thread_search_statistics.tt_cutoffs;
                 return stored_entry.value;
             }
             if (stored_entry.evaluation_type == TranspositionTableEvaluationType::UPPERBOUND &&
                 stored_entry.value <= alpha) {
-#ifdef DEBUG
-                search_ctx.tt_cutoffs.fetch_add(1, std::memory_order_relaxed);
-#endif
+                ++thread_search_statistics.tt_cutoffs;
                 return stored_entry.value;
             }
         }
@@ -256,23 +502,39 @@ int search(CtxT&                   search_ctx,
         return *score;
     }
 
-    generateLegalMoves<Side, MoveGenerationPolicy::COMPETITIVE_FULL>(board, sink,
-                                                                     restriction_context, ply);
+    // Captures are generated now, quiet moves only once they are needed.
+    const Move previous_move = ply > 0 ? thread_ctx.move_at_ply[ply - 1] : Move::none();
+    MovePicker<Config, Side, MoveSinkT> move_picker(board, sink, restriction_context, ply,
+                                                    stored_entry.best_move,
+                                                    thread_ctx.quiet_history, previous_move);
+    const bool in_check = restriction_context.check_count > 0;
 
     // Check if side to move is mated or stalemated.
-    if (sink.count[ply] == 0) {
-        if (restriction_context.check_count > 0) {
+    if (! move_picker.hasLegalMoves()) {
+        if (in_check) {
             return -(CHECKMATE_BASE - ply); // Lower depth mates have higher scores.
         }
         return 0; // Stalemate.
     }
 
+    // Check extension: a position in check is searched one ply deeper, so a line of checks does
+    // not end at the horizon. The TT entry keeps the depth the node was called with, which is the
+    // depth the next probe of the position compares against.
+    const int probe_depth     = depth;
+    int       line_extensions = thread_ctx.line_extensions[ply];
+    if constexpr (! IsRoot && Config.extensions.check) {
+        if (in_check && line_extensions < heuristics::MAX_LINE_EXTENSIONS) {
+            ++depth;
+            ++line_extensions;
+        }
+    }
+
     // At leaf or node budget exhausted.
     // Unlike SEARCH_INTERRUPTED, this is a normal termination, the returned score
     // is real and contributes to the search result.
     bool at_leaf_or_node_budget_exhausted =
         depth == 0 || (search_parameters.max_nodes > 0 &&
-                       search_ctx.nodes_searched >= search_parameters.max_nodes);
+                       search_ctx.nodes_searched.total() >= search_parameters.max_nodes);
 
     if (at_leaf_or_node_budget_exhausted) {
         if constexpr (Config.quiescence.enabled) {
@@ -280,45 +542,148 @@ int search(CtxT&                   search_ctx,
                                                   restriction_context, alpha, beta, st, sink,
                                                   ply + 1);
         }
-        return eval(board, Side);
+        return cachedEval<Side>(search_ctx, board);
     }
 
-    Move tt_move = (stored_entry.key == zobrist_key && stored_entry.depth > 0)
-                       ? stored_entry.best_move
-                       : Move::none();
+    // Evaluation for the pruning decisions below, none of which apply in check.
+    const int static_eval = in_check ? -CHECKMATE_BASE : cachedEval<Side>(search_ctx, board);
+
+    // Reverse futility pruning (static null move): near the horizon, an evaluation above beta by
+    // more than the opponent can win back in the remaining plies is already a cutoff.
+    if constexpr (! IsRoot && Config.reverse_futility_pruning.enabled) {
+        if (! pv_node && ! in_check && ! singular_search &&
+            depth <= heuristics::REVERSE_FUTILITY_MAX_DEPTH &&
+            abs(beta) < CHECKMATE_THRESHOLD &&
+            static_eval - heuristics::reverseFutilityMargin(depth) >= beta) {
+            return static_eval;
+        }
+    }
+
+    // Null-move pruning. Pass the turn and search the opponent's reply with a reduced depth and a
+    // zero window at beta; if the opponent still cannot get below beta, no real move will either.
+    if constexpr (! IsRoot && Config.null_move_pruning.enabled) {
+        const bool after_null_move = ply > 0 && thread_ctx.null_move_at_ply[ply - 1];
+        if (depth >= heuristics::NULL_MOVE_MIN_DEPTH && ! in_check && ! after_null_move &&
+            ! singular_search && abs(beta) < CHECKMATE_THRESHOLD &&
+            heuristics::hasNonPawnMaterial<Side>(board)) {
+            if (static_eval >= beta) {
+                const int reduction = heuristics::nullMoveReduction(depth, static_eval, beta);
+                thread_ctx.null_move_at_ply[ply]    = true;
+                thread_ctx.move_at_ply[ply]         = Move::none();
+                thread_ctx.line_extensions[ply + 1] = line_extensions;
+                move_processor.applyNullMove(board);
+                search_ctx.tt.prefetch(board.getZobristHash());
+                const int score = -search<! Side, Config>(
+                    search_ctx, thread_ctx, board, move_processor, search_parameters,
+                    restriction_context, std::max(depth - 1 - reduction, 0), -beta, -beta + 1, st,
+                    sink, ply + 1);
+                move_processor.undoNullMove(board);
+                thread_ctx.null_move_at_ply[ply] = false;
+                if (abs(score) == SEARCH_INTERRUPTED) {
+                    return SEARCH_INTERRUPTED;
+                }
+                if (score >= beta) {
+                    // A mate found after passing is not a proven mate for this position.
+                    return score >= CHECKMATE_THRESHOLD ? beta : score;
+                }
+            }
+        }
+    }
 
-    heuristics::scoreAndSort<Config>(sink, tt_move, ply);
+    // Singular extension: search every other move at about half the depth against a bound a
+    // little below the TT value. If none of them reaches it, the TT move is the only good one here
+    // and is searched one ply deeper. Not tried while the window only asks for a mate distance,
+    // which a bound near a non-mate TT value cannot answer.
+    bool tt_move_singular = false;
+    if constexpr (! IsRoot && Config.extensions.singular) {
+        if (! singular_search && line_extensions < heuristics::MAX_SINGULAR_LINE_EXTENSIONS &&
+            abs(beta) < CHECKMATE_THRESHOLD &&
+            heuristics::isSingularCandidate(stored_entry, depth)) {
+            const int singular_beta = heuristics::singularBeta(stored_entry.value, depth);
+            // With the line's extension budget spent, the verification is not extended anywhere,
+            // so its depth does not depend on checks.
+            const int node_extensions       = thread_ctx.line_extensions[ply];
+            thread_ctx.line_extensions[ply] = heuristics::MAX_LINE_EXTENSIONS;
+            const int score                 = search<Side, Config>(
+                search_ctx, thread_ctx, board, move_processor, search_parameters,
+                restriction_context, heuristics::singularSearchDepth(depth), singular_beta - 1,
+                singular_beta, st, sink, ply, false, stored_entry.best_move);
+            thread_ctx.line_extensions[ply] = node_extensions;
+            if (abs(score) == SEARCH_INTERRUPTED) {
+                return SEARCH_INTERRUPTED;
+            }
+            tt_move_singular = score < singular_beta;
+            // Multi-cut: besides the TT move, another move reaches a bound that is at least beta.
+            if (! tt_move_singular && singular_beta >= beta) {
+                return singular_beta;
+            }
+            // The verification search generated its own moves at this ply.
+            move_picker.restart();
+        }
+    }
 
-    // Before searching, record the first sorted move as a fallback so the
-    // engine always has a legal move even if the search is interrupted immediately.
+    // Before searching, record a fallback so the engine always has a legal move even if the
+    // search is interrupted immediately: the best move of the previous iteration if it is still
+    // in root_best_move, else the TT move, else the first generated move.
     // Skip for constrained searches: if all search_moves are illegal the engine
     // should signal no move rather than silently picking a different one.
     if constexpr (IsRoot) {
+        move_picker.generateAll();
         if (search_parameters.search_moves.empty()) {
-            search_ctx.root_best_move = sink.moves[0][0];
+            const auto root_moves =
+                std::span(sink.moves[ply].data(), static_cast<std::size_t>(sink.count[ply]));
+            const auto generated = [&root_moves](PackedMove packed) {
+                return std::ranges::find(root_moves, packed, packMove);
+            };
+            if (generated(packMove(thread_ctx.root_best_move)) == root_moves.end()) {
+                const auto tt_move = generated(stored_entry.best_move);
+                thread_ctx.root_best_move =
+                    tt_move != root_moves.end() ? *tt_move : sink.moves[ply][0];
+            }
         }
     }
 
-    // Test hook: pause here so tests can stop the search after sort but before
-    // any recursive call returns, exercising the fallback path deterministically.
+    // Test hook: pause here so tests can stop the search after the root moves are generated but
+    // before any recursive call returns, exercising the fallback path deterministically.
     if constexpr (IsRoot && PauseAfterRootSort) {
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
     }
 
     // Search the node.
-    search_ctx.tt.addSearched(zobrist_key);
-    search_ctx.nodes_searched.fetch_add(1, std::memory_order_relaxed);
+    const bool marked_in_progress = search_ctx.in_progress.enter(zobrist_key);
+    search_ctx.nodes_searched.increment(search_thread_index);
+
+    // Futility pruning: near the horizon, quiet moves cannot lift an evaluation this far below
+    // alpha. At least one move is always searched.
+    bool futile         = false;
+    int  futility_value = 0;
+    if constexpr (Config.futility_pruning.enabled) {
+        futility_value = static_eval + heuristics::futilityMargin(depth);
+        futile         = ! pv_node && ! in_check && depth <= heuristics::FUTILITY_MAX_DEPTH &&
+                         abs(alpha) < CHECKMATE_THRESHOLD && futility_value <= alpha;
+    }
 
-    int               best_score = -CHECKMATE_BASE;
-    Move              best_move  = Move::none();
-    std::vector<bool> needs_search(sink.count[ply], true);
-    bool              all_done = false;
+    int                               best_score = -CHECKMATE_BASE;
+    Move                              best_move  = Move::none();
+    std::array<bool, MAX_LEGAL_MOVES> needs_search;
+    bool                              all_done       = false;
+    int                               searched_moves = 0;
+    needs_search.fill(true);
+    // Quiet moves searched without a cutoff, penalised in the history if a later one cuts off.
+    std::array<Move, MAX_LEGAL_MOVES> searched_quiets;
+    int                               searched_quiet_count = 0;
     for (int iteration = 0; iteration < 2 && ! all_done; iteration++) {
-        all_done    = true;
-        int start_i = 0;
-        int end_i   = sink.count[ply];
-        for (int i = start_i; i < end_i; i++) {
+        all_done = true;
+        // The first pass takes the moves from the picker, which leaves them at sink.moves[ply] in
+        // the same order for the pass over deferred moves.
+        for (int i = 0;; i++) {
+            if (iteration == 0 ? ! move_picker.next() : i >= sink.count[ply]) {
+                break;
+            }
             Move move = sink.moves[ply][i];
+            if (singular_search && packMove(move) == excluded_move) {
+                needs_search[i] = false;
+            }
             if (ply == 0 && search_parameters.search_moves.size() > 0 &&
                 ! search_parameters.search_moves.contains(toUci(move))) {
                 needs_search[i] = false;
@@ -326,15 +691,32 @@ int search(CtxT&                   search_ctx,
             if (! needs_search[i]) {
                 continue;
             }
+            if (futile && searched_moves > 0 && ! move.isCapture() && ! move.isPromotion()) {
+                needs_search[i] = false;
+                best_score      = std::max(best_score, futility_value);
+                continue;
+            }
 
+            const int extension =
+                tt_move_singular && packMove(move) == stored_entry.best_move ? 1 : 0;
+            const int new_depth = depth - 1 + extension;
+
+            const int reduction =
+                lateMoveReductionOf<Config>(move, i, depth, pv_node, in_check);
+
+            thread_ctx.move_at_ply[ply]         = move;
+            thread_ctx.line_extensions[ply + 1] = line_extensions + extension;
             move_processor.applyMove(board, move);
             search_ctx.tt.prefetch(board.getZobristHash());
-            bool is_exclusive = iteration == 0 && i != 0;
-            int  score        = -search<! Side, Config>(search_ctx, board, move_processor,
-                                                        search_parameters, restriction_context, depth - 1,
-                                                        -beta, -alpha, st, sink, ply + 1, is_exclusive);
+            const int score = searchMadeMove<Side, Config>(
+                search_ctx, thread_ctx, board, move_processor, search_parameters,
+                restriction_context, st, sink, ply, new_depth, reduction, alpha, beta,
+                searched_moves == 0, iteration == 0 && i != 0);
             move_processor.undoMove(board, move);
             if (abs(score) == SEARCH_INTERRUPTED) {
+                if (marked_in_progress) {
+                    search_ctx.in_progress.leave(zobrist_key);
+                }
                 return SEARCH_INTERRUPTED;
             }
             if (abs(score) == ON_EVALUATION) {
@@ -342,27 +724,113 @@ int search(CtxT&                   search_ctx,
                 continue;
             }
             needs_search[i] = false;
+            ++searched_moves;
 
             if (score > best_score) {
                 best_score = score;
                 best_move  = move;
                 if constexpr (IsRoot) {
-                    search_ctx.root_best_move = move;
+                    thread_ctx.root_best_move = move;
+                }
+                if (score > alpha) {
+                    thread_ctx.pv.update(ply, move);
                 }
                 alpha = std::max(score, alpha);
             }
+            const bool quiet = ! move.isCapture() && ! move.isPromotion();
             if (alpha >= beta) {
-#ifdef DEBUG
-                search_ctx.beta_cutoffs.fetch_add(1, std::memory_order_relaxed);
-#endif
+                ++thread_search_statistics.beta_cutoffs;
+                if (quiet) {
+                    heuristics::updateQuietMoveHistory<Config, Side>(
+                        thread_ctx.quiet_history, ply, depth, move, previous_move,
+                        std::span<const Move>(searched_quiets.data(), searched_quiet_count));
+                }
+                all_done = true;
+                break;
+            }
+            if (quiet) {
+                searched_quiets[searched_quiet_count++] = move;
+            }
+
+            // Young Brothers Wait: with the first move searched, idle helpers may take the rest.
+            // Not once a move was deferred: the split ends the node before the deferred pass.
+            if (iteration == 0 && all_done && ! singular_search && depth >= SPLIT_MIN_DEPTH &&
+                search_ctx.split_points.hasIdleHelper()) {
+                auto split = std::make_unique<SplitPoint>();
+                for (int j = i + 1; move_picker.next(); ++j) {
+                    const Move& later_move = sink.moves[ply][j];
+                    if (ply == 0 && search_parameters.search_moves.size() > 0 &&
+                        ! search_parameters.search_moves.contains(toUci(later_move))) {
+                        continue;
+                    }
+                    if (futile && ! later_move.isCapture() && ! later_move.isPromotion()) {
+                        best_score = std::max(best_score, futility_value);
+                        continue;
+                    }
+                    split->moves[split->move_count++] = later_move;
+                }
+                if (split->move_count == 0) {
+                    break; // Every later move was filtered out, nothing to share.
+                }
+                split->board             = board;
+                split->move_processor    = move_processor;
+                split->search_parameters = &search_parameters;
+                split->search_ctx        = &search_ctx;
+                split->join              = &joinSplitPoint<Side, Config, CtxT>;
+                split->ply               = ply;
+                split->depth             = depth;
+                split->previous_move     = previous_move;
+                split->beta              = beta;
+                split->line_extensions   = line_extensions;
+                split->pv_node           = pv_node;
+                split->in_check          = in_check;
+                split->extended_move =
+                    tt_move_singular ? stored_entry.best_move : PACKED_MOVE_NONE;
+                split->first_index = i + 1;
+                split->alpha       = alpha;
+                split->best_score  = best_score;
+                split->best_move   = best_move;
+                {
+                    const std::stop_callback stop_split(st, [&split] {
+                        split->stop.request_stop();
+                    });
+                    search_ctx.split_points.open(*split);
+                    searchSplitPointMoves<Side, Config>(*split, search_ctx, thread_ctx, board,
+                                                        move_processor, restriction_context,
+                                                        sink);
+                    search_ctx.split_points.close(*split);
+                    split->waitForHelpers();
+                }
+                if (st.stop_requested() || ! split->completed()) {
+                    if (marked_in_progress) {
+                        search_ctx.in_progress.leave(zobrist_key);
+                    }
+                    return SEARCH_INTERRUPTED;
+                }
+                if (split->best_score > best_score) {
+                    best_score = split->best_score;
+                    best_move  = split->best_move;
+                    if constexpr (IsRoot) {
+                        thread_ctx.root_best_move = best_move;
+                    }
+                    if (best_score > alpha) {
+                        thread_ctx.pv.assign(ply, split->principal_variation);
+                    }
+                    alpha = std::max(best_score, alpha);
+                }
                 all_done = true;
                 break;
             }
         }
     }
 
-    search_ctx.tt.removeSearched(zobrist_key);
-    search_ctx.tt.storeBounded(zobrist_key, best_score, best_move, depth, alpha_orig, beta);
+    if (marked_in_progress) {
+        search_ctx.in_progress.leave(zobrist_key);
+    }
+    if (! singular_search) {
+        search_ctx.tt.storeBounded(zobrist_key, best_score, best_move, probe_depth, alpha_orig,
+                                   beta, ply);
+    }
     return best_score;
 }
 
@@ -5,33 +5,42 @@
 #include "board_state.hpp"
 #include "concepts.hpp"
 #include "fen_formatter.hpp"
+#include "lazy_smp.hpp"
 #include "move.hpp"
 #include "move_processor.hpp"
 #include "move_sink.hpp"
 #include "perft.hpp"
 #include "restriction_context.hpp"
 #include "search.hpp"
+#include "search_thread_pool.hpp"
+#include "split_point.hpp"
+#include "thread_affinity.hpp"
 #include "transposition_table.hpp"
 #include <chrono>
 #include <climits>
 #include <condition_variable>
 #include <constants.hpp>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace bitcrusher {
 
 class SearchManager {
 public:
-    SearchManager() {
-        ZobristKeys::init(12345);
-
-        // Create persistent main worker thread.
-        main_search_thread_ = std::thread([this]() { this->workerThreadMain(); });
+    // Searches run on threads of the pool, the process-wide one unless another is given, so
+    // starting one only wakes threads that already exist.
+    explicit SearchManager(std::shared_ptr<SearchThreadPool> pool = SearchThreadPool::shared())
+        : pool_(std::move(pool)) {
+        ZobristKeys::init(ZOBRIST_SEED);
+        pool_->reserve(max_cores_);
     }
 
     SearchManager(const SearchManager&)            = delete;
@@ -40,30 +49,18 @@ public:
     SearchManager& operator=(SearchManager&&)      = delete;
 
     ~SearchManager() {
-
-        if (search_active_.load()) {
-            stopSearch();
-            waitUntilSearchFinished();
-        }
+        stopSearch();
         {
             std::lock_guard<std::mutex> lock(mutex_);
             shutdown_ = true;
             condition_.notify_all();
         }
-
-        if (main_search_thread_.joinable()) {
-            main_search_thread_.join();
-        }
-        for (auto& thread : workers_) {
-            if (thread.joinable()) {
-                thread.join();
-            }
-        }
-        workers_.clear();
+        waitForSearchThreads();
         {
             std::lock_guard<std::mutex> lock(mutex_);
-            onDepthCompleted_ = nullptr;
-            onSearchFinished_ = nullptr;
+            onDepthCompleted_   = nullptr;
+            onAspirationFailed_ = nullptr;
+            onSearchFinished_   = nullptr;
         }
     }
 
@@ -74,19 +71,31 @@ public:
             stopSearch();
             waitUntilSearchFinished();
         }
-        search_ctx_.tt.clear();
+        // Helpers of the last search may still be returning from their search.
+        waitForSearchThreads();
+        // Keep the table across moves of a game; it is only cleared by newGame().
+        search_ctx_.tt.newSearch();
+        {
+            const std::lock_guard<std::mutex> lock(search_ctx_.statistics_mutex);
+            search_ctx_.statistics = {};
+        }
+        {
+            const std::lock_guard<std::mutex> lock(results_mutex_);
+            thread_results_.assign(max_cores_, ThreadResult{});
+        }
         // Update search parameters and state with lock.
         {
             std::lock_guard<std::mutex> lock(mutex_);
             search_options_                 = search_parameters;
             start_time_                     = std::chrono::steady_clock::now();
-            search_ctx_.nodes_searched      = 0;
+            search_ctx_.nodes_searched.reset();
             search_ctx_.is_pondering        = search_parameters.ponder;
             search_ctx_.time_limit_start_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
                                                   start_time_.time_since_epoch())
                                                   .count();
-            stop_source_   = std::stop_source();
-            search_active_ = true;
+            stop_source_     = std::stop_source();
+            search_active_   = true;
+            running_threads_ = max_cores_;
             // Calculate move time allocation.
             if (board_.isWhiteMove()) {
                 search_time_ms_ = calculateMoveTimeAllocation<Color::WHITE>(search_parameters);
@@ -96,17 +105,28 @@ public:
             }
             search_ctx_.max_search_time_ms = search_time_ms_;
         }
-        search_fn_ = [this](SearchParameters opts, BoardState board, MoveProcessor mp,
-                            std::stop_token st, SharedSearchContext& ctx) {
-            if (opts.use_quiescence_search) {
-                performSearch<FastMoveSink, true, DEFAULT_CONFIG, PauseAfterRootSort>(opts, board,
-                                                                                      mp, st, ctx);
-            } else {
-                performSearch<FastMoveSink, true, NO_QUIESCENCE_CONFIG, PauseAfterRootSort>(
-                    opts, board, mp, st, ctx);
-            }
-        };
-        condition_.notify_all(); // Notifies main and all worker threads.
+        // Each search thread gets its own copy of the position.
+        const std::stop_token                       st       = stop_source_.get_token();
+        const ParallelSearchMode                    mode     = parallel_search_mode_;
+        const std::shared_ptr<const ThreadAffinity> affinity = getThreadAffinity();
+        // Every thread binds itself before allocating its own move sink, history tables and
+        // stack frames, which then come from the thread's NUMA node. The shared state in
+        // search_ctx_ stays where it was first touched: the node counters on the thread that
+        // sized them, the table on the threads that zeroed it when it was last allocated.
+        pool_->submit([this, search_parameters, board = board_, move_processor = move_processor_,
+                       st, affinity]() {
+            affinity->bindCurrentThread(0);
+            runMainSearch<PauseAfterRootSort>(search_parameters, board, move_processor, st);
+            finishSearchThread();
+        });
+        for (int i = 1; i < max_cores_; ++i) {
+            pool_->submit([this, i, search_parameters, board = board_,
+                           move_processor = move_processor_, st, mode, affinity]() {
+                affinity->bindCurrentThread(i);
+                runHelperSearch(i, search_parameters, board, move_processor, st, mode);
+                finishSearchThread();
+            });
+        }
     }
 
     void waitUntilSearchFinished() {
@@ -121,7 +141,7 @@ public:
         stop_source_.request_stop();
     }
 
-    [[nodiscard]] uint64_t getNodeCount() const { return search_ctx_.nodes_searched.load(); }
+    [[nodiscard]] uint64_t getNodeCount() const { return search_ctx_.nodes_searched.total(); }
 
     [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getSearchStartTime() const {
         return start_time_;
@@ -158,9 +178,47 @@ public:
         onDepthCompleted_ = callback;
     }
 
+    // Called by the main thread when an aspiration window fails and the iteration is searched
+    // again, with the bound the failed search proved.
+    void setOnAspirationFailed(const std::function<void(int, int, ScoreBound)>& callback) {
+        onAspirationFailed_ = callback;
+    }
+
     constexpr void setPosToStartpos() { parseFEN(INITIAL_POSITION_FEN, board_); }
 
-    inline void setHashMBSize(int size) { search_ctx_.tt.setMBSize(size); }
+    // Zeroed by one thread per search thread, so each first-touches part of the table. Like every
+    // change to the tables, waits for the threads of a search to return first.
+    inline void setHashMBSize(int size) {
+        waitForSearchThreads();
+        search_ctx_.tt.setMBSize(size, max_cores_, parallelSlices());
+    }
+
+    void setEvalCacheMBSize(int size) {
+        waitForSearchThreads();
+        search_ctx_.eval_cache.setMBSize(size);
+    }
+
+    [[nodiscard]] LargePageStatus getHashLargePageStatus() const {
+        return search_ctx_.tt.getLargePageStatus();
+    }
+
+    // Saves the transposition table so a later session can start from it. Waits for a running
+    // search to finish first, helpers included.
+    TranspositionTableFileStatus saveHash(const std::filesystem::path& path) {
+        waitForSearchThreads();
+        return search_ctx_.tt.save(path, ZobristKeys::getSeed());
+    }
+
+    // Replaces the transposition table, and its size, with a saved one.
+    TranspositionTableFileStatus loadHash(const std::filesystem::path& path) {
+        waitForSearchThreads();
+        return search_ctx_.tt.load(path, ZobristKeys::getSeed(), max_cores_, parallelSlices());
+    }
+
+    [[nodiscard]] size_t getHashMBSize() const {
+        return search_ctx_.tt.getEntryCount() / TT_ENTRIES_PER_BUCKET *
+               sizeof(TranspositionTableBucket) / (1024ULL * 1024ULL);
+    }
 
     void setPos(std::string_view fen) { parseFEN(fen, board_); }
 
@@ -170,79 +228,81 @@ public:
 
     std::string bestMoveUci() { return toUci(best_move_); }
 
-    std::string getPrincipalVariation(int depth) {
-        BoardState  pv_board = board_;
-        std::string ans      = toUci(best_move_);
-
-        MoveProcessor mp;
-
-        mp.applyMove(pv_board, best_move_);
-        uint64_t visited[MAX_DEPTH];
-        int      visited_count        = 0;
-        visited[visited_count++]      = board_.getZobristHash();
-        visited[visited_count++]      = pv_board.getZobristHash();
-        int max_remaining_moves_in_pv = std::min(depth - 1, 19); // cap at 20 moves total
-        while (max_remaining_moves_in_pv-- > 0) {
-            uint64_t hash            = pv_board.getZobristHash();
-            auto     best_move_entry = search_ctx_.tt.getEntry(hash);
-            if (best_move_entry.value == NOT_FOUND_IN_TRANSPOSITION_TABLE ||
-                best_move_entry.best_move.isNullMove() || best_move_entry.key != hash ||
-                best_move_entry.depth < 0) {
-                break;
-            }
-            // Validate TT move: check piece is on from-square (guards against hash collisions).
-            uint64_t own_occ = pv_board.isWhiteMove() ? pv_board.getOwnOccupancy<Color::WHITE>()
-                                                      : pv_board.getOwnOccupancy<Color::BLACK>();
-            if (! (own_occ & (1ULL << static_cast<int>(best_move_entry.best_move.fromSquare())))) {
-                break;
-            }
-
-            if (pv_board.getHalfmoveClock() >= 100) {
-                break; // Don't show moves past the fifty-move rule boundary.
-            }
-            mp.applyMove(pv_board, best_move_entry.best_move);
-            uint64_t new_hash = pv_board.getZobristHash();
-            if (std::find(visited, visited + visited_count, new_hash) != visited + visited_count) {
-                break; // Cycle detected — don't add this move to the PV.
+    // Line behind the last completed iteration's score. If an unfinished iteration has since
+    // changed the best move, only that move is known.
+    std::string getPrincipalVariation() const {
+        if (principal_variation_.empty() || principal_variation_.front() != best_move_) {
+            return toUci(best_move_);
+        }
+        std::string pv;
+        for (const Move& move : principal_variation_) {
+            if (! pv.empty()) {
+                pv += ' ';
             }
-            visited[visited_count++] = new_hash;
-            ans += " " + toUci(best_move_entry.best_move);
+            pv += toUci(move);
         }
-        return ans;
+        return pv;
     }
 
-    std::string getScore() const {
-        if (std::abs(score_) >= CHECKMATE_THRESHOLD) {
-            int         mate_distance = CHECKMATE_BASE - std::abs(score_);
+    std::string getScore() const { return formatScore(score_); }
+
+    // UCI score text: "cp <centipawns>" or "mate <moves>", negative when getting mated.
+    static std::string formatScore(int score) {
+        if (std::abs(score) >= CHECKMATE_THRESHOLD) {
+            int         mate_distance = CHECKMATE_BASE - std::abs(score);
             int         moves_to_mate = (mate_distance + 1) / 2;
-            std::string sign          = score_ < 0 ? "-" : "";
+            std::string sign          = score < 0 ? "-" : "";
             return "mate " + sign + std::to_string(moves_to_mate);
         }
 
-        return "cp " + std::to_string(score_);
+        return "cp " + std::to_string(score);
     }
 
     void resetMoveProcessor() { move_processor_.resetHistory(); }
 
     void newGame() {
+        waitForSearchThreads();
         move_processor_.resetHistory();
-        search_ctx_.tt.clear();
+        search_ctx_.tt.clear(max_cores_, parallelSlices());
     }
-#ifdef DEBUG
-    int getBetaCutoffs() { return search_ctx_.beta_cutoffs.load(); }
+    // Counters merged so far in the current search, complete for every finished iteration of the
+    // main thread.
+    [[nodiscard]] SearchStatistics getStatistics() {
+        const std::lock_guard<std::mutex> lock(search_ctx_.statistics_mutex);
+        return search_ctx_.statistics;
+    }
+
+    [[nodiscard]] int getHashfull() const { return search_ctx_.tt.hashfull(); }
 
-    int getTTCutoffs() { return search_ctx_.tt_cutoffs.load(); }
+    [[nodiscard]] bool isDebug() const { return debug_; }
 
-    double getTTUsage() const { return search_ctx_.tt.getUsedPercentage(); }
-#endif
     void setDebug(bool value) { debug_ = value; }
 
+    // Makes sure the pool has a thread for each search thread; nothing is joined or respawned.
     void setMaxCores(int cores) {
+        waitForSearchThreads();
         max_cores_ = cores;
-        shutdownWorkers();
-        for (int i = 0; i < max_cores_ - 1; ++i) {
-            workers_.emplace_back([this]() { this->workerThread(); });
-        }
+        search_ctx_.nodes_searched.resize(max_cores_);
+        pool_->reserve(max_cores_);
+    }
+
+    // Takes effect from the next search. Pages of the table already allocated do not move, only
+    // the next resize or loadHash places it by the new binding.
+    void setThreadAffinity(ThreadAffinity affinity) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        thread_affinity_ = std::make_shared<const ThreadAffinity>(std::move(affinity));
+    }
+
+    [[nodiscard]] std::shared_ptr<const ThreadAffinity> getThreadAffinity() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return thread_affinity_;
+    }
+
+    // Takes effect from the next search.
+    void setParallelSearchMode(ParallelSearchMode mode) { parallel_search_mode_ = mode; }
+
+    [[nodiscard]] ParallelSearchMode getParallelSearchMode() const {
+        return parallel_search_mode_;
     }
 
     uint64_t performPerft(int depth) {
@@ -277,93 +337,94 @@ public:
     }
 
 private:
-    void workerThreadMain() {
-        while (true) {
-            // Wait for work or shutdown signal.
-            std::unique_lock<std::mutex> lock(mutex_);
-            condition_.wait(lock, [this] { return search_active_.load() || shutdown_; });
-
-            if (shutdown_) {
-                break; // Exit thread.
-            }
-
-            // Copy necessary data for thread-safe access.
-            SearchParameters     local_options         = search_options_;
-            BoardState           thread_board          = board_;
-            auto                 stop_token            = stop_source_.get_token();
-            MoveProcessor        thread_move_processor = move_processor_;
-            auto                 thread_start_time     = start_time_;
-            int                  thread_search_time_ms = search_time_ms_;
-            SharedSearchContext& ctx                   = search_ctx_;
-            lock.unlock();
-            search_fn_(local_options, thread_board, thread_move_processor, stop_token, ctx);
-
-            {
-                std::unique_lock<std::mutex> wait_lock(mutex_);
-                condition_.wait(wait_lock, [this, stop_token] {
-                    return ! search_ctx_.is_pondering.load() || shutdown_ ||
-                           stop_token.stop_requested();
-                });
-            }
-
-            handleSearchFinished();
+    template <bool PauseAfterRootSort>
+    void runMainSearch(const SearchParameters& search_parameters,
+                       BoardState              board,
+                       MoveProcessor           move_processor,
+                       std::stop_token         st) {
+        if (search_parameters.use_quiescence_search) {
+            performSearch<FastMoveSink, true, DEFAULT_CONFIG, PauseAfterRootSort>(
+                search_parameters, board, move_processor, st, search_ctx_);
+        } else {
+            performSearch<FastMoveSink, true, NO_QUIESCENCE_CONFIG, PauseAfterRootSort>(
+                search_parameters, board, move_processor, st, search_ctx_);
         }
-    }
 
-    void workerThread() {
-        while (true) {
-            // Wait for work or shutdown signal.
-            std::unique_lock<std::mutex> lock(mutex_);
-            condition_.wait(lock, [this] {
-                return search_active_.load() || shutdown_.load() || workers_shutdown_.load();
+        {
+            std::unique_lock<std::mutex> wait_lock(mutex_);
+            condition_.wait(wait_lock, [this, st] {
+                return ! search_ctx_.is_pondering.load() || shutdown_ || st.stop_requested();
             });
+        }
 
-            if (shutdown_ || workers_shutdown_) {
-                break; // Exit thread.
-            }
+        playVotedMove();
+        handleSearchFinished();
+    }
 
-            // Copy necessary data for thread-safe access.
-            SearchParameters     local_options         = search_options_;
-            BoardState           thread_board          = board_;
-            auto                 stop_token            = stop_source_.get_token();
-            MoveProcessor        thread_move_processor = move_processor_;
-            auto                 thread_start_time     = start_time_;
-            int                  thread_search_time_ms = search_time_ms_;
-            SharedSearchContext& ctx                   = search_ctx_;
-            lock.unlock();
-
-            performSearch<FastMoveSink, false, DEFAULT_CONFIG>(
-                local_options, thread_board, thread_move_processor, stop_token, ctx);
-
-            // Wait for main thread to finish searching.
-            {
-                std::unique_lock<std::mutex> lock(mutex_);
-                condition_.wait(lock, [this] {
-                    return ! search_active_.load() || shutdown_.load() || workers_shutdown_.load();
-                });
-                if (shutdown_ || workers_shutdown_) {
-                    break;
-                }
-            }
+    // Helper search thread thread_index, from 1 up to max_cores_ - 1.
+    void runHelperSearch(int                     thread_index,
+                         const SearchParameters& search_parameters,
+                         BoardState              board,
+                         MoveProcessor           move_processor,
+                         std::stop_token         st,
+                         ParallelSearchMode      mode) {
+        if (mode == ParallelSearchMode::YBWC) {
+            helpAtSplitPoints(thread_index, st, search_ctx_);
+        } else if (search_parameters.use_quiescence_search) {
+            performSearch<FastMoveSink, false, DEFAULT_CONFIG>(search_parameters, board,
+                                                               move_processor, st, search_ctx_,
+                                                               thread_index);
+        } else {
+            performSearch<FastMoveSink, false, NO_QUIESCENCE_CONFIG>(
+                search_parameters, board, move_processor, st, search_ctx_, thread_index);
         }
     }
 
-    void shutdownWorkers() {
-        if (workers_.size() == 0) {
-            return;
-        }
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            workers_shutdown_ = true;
-            condition_.notify_all();
-        }
-        for (auto& thread : workers_) {
-            if (thread.joinable()) {
-                thread.join();
+    // Runs table slice i on a pool thread bound like search thread i, so the pages it touches
+    // first land on the node of the thread that later searches with them.
+    ParallelSlices parallelSlices() {
+        return [this](int slices, const std::function<void(int)>& task) {
+            const std::shared_ptr<const ThreadAffinity> affinity = getThreadAffinity();
+            std::mutex                                  mutex;
+            std::condition_variable                     done;
+            int                                         remaining = slices;
+            for (int slice = 0; slice < slices; ++slice) {
+                pool_->submit([&, slice]() {
+                    affinity->bindCurrentThread(slice);
+                    task(slice);
+                    const std::lock_guard<std::mutex> lock(mutex);
+                    if (--remaining == 0) {
+                        done.notify_one();
+                    }
+                });
             }
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [&remaining] { return remaining == 0; });
+        };
+    }
+
+    // The last thing a search thread does: the manager may be destroyed once every one has.
+    void finishSearchThread() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        --running_threads_;
+        condition_.notify_all();
+    }
+
+    void waitForSearchThreads() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return running_threads_ == 0; });
+    }
+
+    // YBWC helper: searches moves of the split points other threads open until the search stops.
+    static void helpAtSplitPoints(int thread_index, std::stop_token st, SharedSearchContext& ctx) {
+        search_thread_index      = thread_index;
+        thread_search_statistics = {};
+        SplitWorker worker;
+        while (SplitPoint* split = ctx.split_points.waitAndJoin(st)) {
+            split->join(*split, worker);
+            split->leave();
         }
-        workers_.clear();
-        workers_shutdown_ = false; // Reset for future searches.
+        mergeThreadStatistics(ctx);
     }
 
     template <MoveSink     MoveSinkT,
@@ -374,37 +435,117 @@ private:
                        BoardState              board,
                        MoveProcessor           move_processor,
                        std::stop_token&        st,
-                       SharedSearchContext&    search_ctx) {
-        FastMoveSink       sink;
+                       SharedSearchContext&    search_ctx,
+                       int                     thread_index = 0) {
+        search_thread_index = thread_index;
         RestrictionContext restriction_context;
+        // Heap allocated, they grow with every per-thread heuristic table and the ordering scores.
+        auto thread_ctx = std::make_unique<ThreadSearchContext>();
+        auto sink       = std::make_unique<FastMoveSink>();
         if constexpr (IsMainThread) {
-            search_ctx.root_best_move = Move::none();
+            principal_variation_.clear();
         }
-        for (int ply = 1; ply <= search_parameters.max_ply; ply++) {
-
-            int score{0};
+        thread_search_statistics = {};
+        // Every thread searches the root as the root, with its own root best move.
+        auto search_root = [&](int depth, int alpha, int beta) {
             if (board.isWhiteMove()) {
-                score = bitcrusher::search<Color::WHITE, Config, IsMainThread, PauseAfterRootSort>(
-                    search_ctx, board, move_processor, search_parameters, restriction_context, ply,
-                    -CHECKMATE_BASE, CHECKMATE_BASE, st, sink);
-            } else {
-                score = bitcrusher::search<Color::BLACK, Config, IsMainThread, PauseAfterRootSort>(
-                    search_ctx, board, move_processor, search_parameters, restriction_context, ply,
-                    -CHECKMATE_BASE, CHECKMATE_BASE, st, sink);
+                return bitcrusher::search<Color::WHITE, Config, true, PauseAfterRootSort>(
+                    search_ctx, *thread_ctx, board, move_processor, search_parameters,
+                    restriction_context, depth, alpha, beta, st, *sink);
             }
-            if constexpr (IsMainThread) {
-                best_move_ = search_ctx.root_best_move;
-                if (abs(score) != SEARCH_INTERRUPTED) {
-                    assert(abs(score) != ON_EVALUATION);
-                    score_ = score;
-                    if ((ply % 2 == 0) && onDepthCompleted_) {
-                        onDepthCompleted_(ply / 2);
-                    }
+            return bitcrusher::search<Color::BLACK, Config, true, PauseAfterRootSort>(
+                search_ctx, *thread_ctx, board, move_processor, search_parameters,
+                restriction_context, depth, alpha, beta, st, *sink);
+        };
+        int  previous_score = 0;
+        Move best_move      = Move::none(); // Root best move after the last iteration.
+        // One iteration per ply of depth, each reported as soon as it completes.
+        for (int depth = 1; depth <= search_parameters.max_ply; depth++) {
+            if (skipsIteration(thread_index, depth)) {
+                continue;
+            }
+            int delta = ASPIRATION_WINDOW;
+            int alpha = -CHECKMATE_BASE;
+            int beta  = CHECKMATE_BASE;
+            if (depth >= ASPIRATION_MIN_DEPTH && std::abs(previous_score) < CHECKMATE_THRESHOLD) {
+                alpha = std::max(previous_score - delta, -CHECKMATE_BASE);
+                beta  = std::min(previous_score + delta, CHECKMATE_BASE);
+            }
+
+            int score = search_root(depth, alpha, beta);
+            // Widen the failed side and search again until the score lies inside the window.
+            while (std::abs(score) != SEARCH_INTERRUPTED &&
+                   ((score <= alpha && alpha > -CHECKMATE_BASE) ||
+                    (score >= beta && beta < CHECKMATE_BASE))) {
+                const ScoreBound bound = score <= alpha ? ScoreBound::UPPER : ScoreBound::LOWER;
+                delta *= 2;
+                if (bound == ScoreBound::UPPER) {
+                    alpha = std::max(score - delta, -CHECKMATE_BASE);
+                    // Every root move failed low, so none of them is known to be best. The root
+                    // keeps a legal root_best_move as its fallback, so a re-search interrupted
+                    // before any move completes reports the previous iteration's move.
+                    thread_ctx->root_best_move = best_move;
                 } else {
-                    break;
+                    beta = std::min(score + delta, CHECKMATE_BASE);
+                }
+                if constexpr (IsMainThread) {
+                    if (onAspirationFailed_) {
+                        onAspirationFailed_(depth, score, bound);
+                    }
+                }
+                score = search_root(depth, alpha, beta);
+            }
+            mergeThreadStatistics(search_ctx);
+            best_move = thread_ctx->root_best_move;
+            if constexpr (IsMainThread) {
+                best_move_ = best_move;
+            }
+            if (std::abs(score) == SEARCH_INTERRUPTED) {
+                break;
+            }
+            assert(abs(score) != ON_EVALUATION);
+            previous_score                   = score;
+            const std::span<const Move> line = thread_ctx->pv.line();
+            recordThreadResult(thread_index, {best_move, depth, score, {line.begin(), line.end()}});
+            if constexpr (IsMainThread) {
+                score_ = score;
+                principal_variation_.assign(line.begin(), line.end());
+                if (onDepthCompleted_) {
+                    onDepthCompleted_(depth);
                 }
             }
         }
+        if constexpr (IsMainThread) {
+            // An unfinished iteration may have found a better move since.
+            const std::lock_guard<std::mutex> lock(results_mutex_);
+            if (! thread_results_.empty()) {
+                thread_results_[0].best_move = best_move_;
+            }
+        }
+    }
+
+    void recordThreadResult(int thread_index, ThreadResult result) {
+        const std::lock_guard<std::mutex> lock(results_mutex_);
+        if (thread_index < static_cast<int>(thread_results_.size())) {
+            thread_results_[thread_index] = std::move(result);
+        }
+    }
+
+    // Plays the move the search threads voted for, with the line and score of a thread that
+    // chose it. Helpers may still be finishing an iteration, so their last completed ones count.
+    void playVotedMove() {
+        const std::lock_guard<std::mutex> lock(results_mutex_);
+        if (thread_results_.size() <= 1) {
+            return;
+        }
+        const std::size_t winner = pickVotedResult(thread_results_);
+        if (winner == 0) {
+            return;
+        }
+        const ThreadResult& result = thread_results_[winner];
+        best_move_                 = result.best_move;
+        score_                     = result.score;
+        principal_variation_       = result.principal_variation;
     }
 
     void handleSearchFinished() {
@@ -419,11 +560,10 @@ private:
         }
     }
 
-    std::thread              main_search_thread_;
-    std::vector<std::thread> workers_;
-    std::atomic<bool>        shutdown_{false};
-    std::atomic<bool>        workers_shutdown_{false};
-    std::atomic<bool>        search_active_{false};
+    std::shared_ptr<SearchThreadPool> pool_;
+    int                               running_threads_{0}; // Search tasks not finished yet.
+    std::atomic<bool>                 shutdown_{false};
+    std::atomic<bool>                 search_active_{false};
 
     std::mutex              mutex_;
     std::condition_variable condition_;
@@ -437,17 +577,23 @@ private:
     BoardState    board_{};
     MoveProcessor move_processor_;
 
-    std::function<void(
-        SearchParameters, BoardState, MoveProcessor, std::stop_token, SharedSearchContext&)>
-                             search_fn_;
-    std::function<void()>    onSearchFinished_;
-    std::function<void(int)> onDepthCompleted_;
+    std::function<void()>                     onSearchFinished_;
+    std::function<void(int)>                  onDepthCompleted_;
+    std::function<void(int, int, ScoreBound)> onAspirationFailed_;
+
+    Move              best_move_;
+    std::vector<Move> principal_variation_; // Written by the main search thread only.
 
-    Move best_move_;
-    int  score_{0};
-    bool debug_{false};
+    std::mutex                results_mutex_;
+    std::vector<ThreadResult> thread_results_; // Indexed by search thread, the main thread first.
+    int               score_{0};
+    bool              debug_{false};
 
-    int max_cores_{1};
+    int                max_cores_{1};
+    ParallelSearchMode parallel_search_mode_{ParallelSearchMode::LAZY_SMP};
+    // Replaced, never modified, so a search keeps the affinity it started with.
+    std::shared_ptr<const ThreadAffinity> thread_affinity_ =
+        std::make_shared<const ThreadAffinity>();
 };
 
 } // namespace bitcrusher
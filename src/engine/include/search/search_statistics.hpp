@@ -0,0 +1,54 @@
+#ifndef BITCRUSHER_SEARCH_STATISTICS_HPP
+#define BITCRUSHER_SEARCH_STATISTICS_HPP
+
+#include <cstdint>
+
+namespace bitcrusher {
+
+struct SearchStatistics {
+    uint64_t tt_probes{0};
+    uint64_t tt_hits{0};
+    uint64_t tt_collisions{0};   // Hits whose move is not legal in the probed position.
+    uint64_t tt_stores{0};
+    uint64_t tt_replacements{0}; // Stores that evicted another live position.
+    uint64_t tt_cutoffs{0};
+    uint64_t beta_cutoffs{0};
+    uint64_t eval_cache_probes{0};
+    uint64_t eval_cache_hits{0};
+
+    SearchStatistics& operator+=(const SearchStatistics& other) noexcept {
+        tt_probes += other.tt_probes;
+        tt_hits += other.tt_hits;
+        tt_collisions += other.tt_collisions;
+        tt_stores += other.tt_stores;
+        tt_replacements += other.tt_replacements;
+        tt_cutoffs += other.tt_cutoffs;
+        beta_cutoffs += other.beta_cutoffs;
+        eval_cache_probes += other.eval_cache_probes;
+        eval_cache_hits += other.eval_cache_hits;
+        return *this;
+    }
+
+    [[nodiscard]] double ttHitRate() const noexcept { return percentOf(tt_hits, tt_probes); }
+
+    [[nodiscard]] double ttCollisionRate() const noexcept {
+        return percentOf(tt_collisions, tt_probes);
+    }
+
+    [[nodiscard]] double evalCacheHitRate() const noexcept {
+        return percentOf(eval_cache_hits, eval_cache_probes);
+    }
+
+private:
+    [[nodiscard]] static double percentOf(uint64_t count, uint64_t total) noexcept {
+        return total > 0 ? static_cast<double>(count) * 100.0 / static_cast<double>(total) : 0.0;
+    }
+};
+
+// Counters of the calling search thread. Plain increments with no sharing between threads;
+// SearchManager folds them into the search totals after every iteration.
+inline thread_local SearchStatistics thread_search_statistics{};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_SEARCH_STATISTICS_HPP
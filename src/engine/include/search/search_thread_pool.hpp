@@ -0,0 +1,188 @@
+#ifndef BITCRUSHER_SEARCH_THREAD_POOL_HPP
+#define BITCRUSHER_SEARCH_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bitcrusher {
+
+/// @brief Persistent threads that run search tasks, shared by any number of SearchManagers.
+///
+/// Starting a task wakes an idle thread; a thread is only created when every one is busy, so the
+/// pool grows to the most tasks ever run at once and keeps that size. resize() creates threads
+/// ahead of time or lets surplus ones exit once idle, and never waits for a thread. Threads are
+/// only joined when the pool is destroyed.
+class SearchThreadPool {
+    struct Worker {
+        std::mutex              mutex;
+        std::condition_variable wake;
+        std::function<void()>   task;
+        bool                    retire{false};
+        std::atomic<bool>       exited{false};
+        std::thread             thread;
+    };
+
+    std::mutex                           mutex_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<Worker*>                 idle_;
+    std::vector<std::unique_ptr<Worker>> retired_; // Exited or exiting, joined when reaped.
+    std::size_t                          target_size_{0};
+    bool                                 shutting_down_{false};
+
+public:
+    explicit SearchThreadPool(std::size_t size = 0) { resize(size); }
+
+    SearchThreadPool(const SearchThreadPool&)            = delete;
+    SearchThreadPool(SearchThreadPool&&)                 = delete;
+    SearchThreadPool& operator=(const SearchThreadPool&) = delete;
+    SearchThreadPool& operator=(SearchThreadPool&&)      = delete;
+
+    // Waits for running tasks to finish.
+    ~SearchThreadPool() {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            shutting_down_ = true;
+            for (Worker* worker : idle_) {
+                retireIdle(*worker);
+            }
+            idle_.clear();
+        }
+        for (auto* workers : {&workers_, &retired_}) {
+            for (const auto& worker : *workers) {
+                worker->thread.join();
+            }
+        }
+    }
+
+    // The pool every SearchManager uses unless given another one.
+    [[nodiscard]] static std::shared_ptr<SearchThreadPool> shared() {
+        static const std::shared_ptr<SearchThreadPool> pool = std::make_shared<SearchThreadPool>();
+        return pool;
+    }
+
+    /// @brief Creates threads up to size, or lets idle threads above it exit. Busy threads above
+    /// it exit when their task ends.
+    void resize(std::size_t size) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        target_size_ = size;
+        reapExited();
+        while (workers_.size() < target_size_) {
+            idle_.push_back(&spawn());
+        }
+        while (workers_.size() > target_size_ && ! idle_.empty()) {
+            Worker* worker = idle_.back();
+            idle_.pop_back();
+            retireIdle(*worker);
+            retire(*worker);
+        }
+    }
+
+    // Threads alive and not exiting, busy or idle.
+    [[nodiscard]] std::size_t size() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return workers_.size();
+    }
+
+    // Grows the pool to at least size threads.
+    void reserve(std::size_t size) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        target_size_ = std::max(target_size_, size);
+        while (workers_.size() < target_size_) {
+            idle_.push_back(&spawn());
+        }
+    }
+
+    // Runs task on an idle thread, creating one if every thread is busy.
+    void submit(std::function<void()> task) {
+        Worker* worker = nullptr;
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            if (idle_.empty()) {
+                worker       = &spawn();
+                target_size_ = std::max(target_size_, workers_.size());
+            } else {
+                worker = idle_.back();
+                idle_.pop_back();
+            }
+        }
+        {
+            const std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->task = std::move(task);
+        }
+        worker->wake.notify_one();
+    }
+
+private:
+    // Called with mutex_ held.
+    Worker& spawn() {
+        Worker& worker = *workers_.emplace_back(std::make_unique<Worker>());
+        worker.thread  = std::thread([this, &worker]() { run(worker); });
+        return worker;
+    }
+
+    // Called with mutex_ held, for a worker no longer in idle_.
+    static void retireIdle(Worker& worker) {
+        {
+            const std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.retire = true;
+        }
+        worker.wake.notify_one();
+    }
+
+    // Called with mutex_ held: moves the worker from workers_ to retired_.
+    void retire(Worker& worker) {
+        const auto found = std::find_if(workers_.begin(), workers_.end(),
+                                        [&](const auto& owned) { return owned.get() == &worker; });
+        retired_.push_back(std::move(*found));
+        workers_.erase(found);
+    }
+
+    // Called with mutex_ held. Joining a thread that has exited does not wait.
+    void reapExited() {
+        std::erase_if(retired_, [](const std::unique_ptr<Worker>& worker) {
+            if (! worker->exited.load(std::memory_order_acquire)) {
+                return false;
+            }
+            worker->thread.join();
+            return true;
+        });
+    }
+
+    void run(Worker& worker) {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(worker.mutex);
+                worker.wake.wait(lock, [&worker] { return worker.task || worker.retire; });
+                if (! worker.task) {
+                    break;
+                }
+                task        = std::move(worker.task);
+                worker.task = nullptr;
+            }
+            task();
+
+            const std::lock_guard<std::mutex> lock(mutex_);
+            if (shutting_down_ || workers_.size() > target_size_) {
+                if (! shutting_down_) {
+                    retire(worker);
+                }
+                break;
+            }
+            idle_.push_back(&worker);
+        }
+        worker.exited.store(true, std::memory_order_release);
+    }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_SEARCH_THREAD_POOL_HPP
@@ -0,0 +1,187 @@
+#ifndef BITCRUSHER_SPLIT_POINT_HPP
+#define BITCRUSHER_SPLIT_POINT_HPP
+
+#include "board_state.hpp"
+#include "move.hpp"
+#include "move_processor.hpp"
+#include "move_sink.hpp"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <vector>
+
+namespace bitcrusher {
+
+// How the threads of a search share the work.
+enum class ParallelSearchMode : std::uint8_t {
+    LAZY_SMP, // Every thread searches the whole tree, sharing the transposition table.
+    YBWC,     // Helpers search the remaining moves of nodes whose first move is searched.
+};
+
+// Young Brothers Wait: a node is only split once its first move is searched, and only this deep
+// or deeper, where the work handed out outweighs the cost of a split.
+inline constexpr int SPLIT_MIN_DEPTH = 4;
+
+struct SearchParameters;
+struct SplitWorker; // The search state of a helper thread, defined by search.hpp.
+
+struct SplitMove {
+    Move move;
+    int  index; // Position of the move in the node's move order.
+    int  alpha;
+};
+
+/// @brief The moves of a node left after its first one, searched by its own thread and any idle
+/// helper that joins. Holds a copy of the position so helpers can start from it while the owning
+/// thread makes moves on its own board.
+struct SplitPoint {
+    BoardState              board;
+    MoveProcessor           move_processor;
+    const SearchParameters* search_parameters{nullptr};
+    void*                   search_ctx{nullptr};
+    // Searches moves of the split point with a helper's state, for the node's side and config.
+    void (*join)(SplitPoint&, SplitWorker&){nullptr};
+
+    int        ply{0};
+    int        depth{0};
+    Move       previous_move{Move::none()}; // Move leading to the node.
+    int        beta{0};
+    int        line_extensions{0};
+    bool       pv_node{false};
+    bool       in_check{false};
+    PackedMove extended_move{PACKED_MOVE_NONE}; // Searched one ply deeper.
+
+    std::array<Move, MAX_LEGAL_MOVES> moves{};
+    int                               move_count{0};
+    int                               first_index{0}; // Node move index of moves[0].
+
+    // Stops every search below the split point on a cutoff, or when the node itself is stopped.
+    std::stop_source stop;
+
+    std::mutex              mutex;
+    std::condition_variable helpers_done;
+    int                     next_move{0};
+    int                     helpers{0};
+    int                     alpha{0};
+    int                     best_score{0};
+    Move                    best_move{Move::none()};
+    std::vector<Move>       principal_variation; // From the best move, when it raised alpha.
+    bool                    cutoff{false};
+    bool                    interrupted{false}; // A move was not searched to the end.
+
+    [[nodiscard]] std::optional<SplitMove> takeMove() {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (cutoff || interrupted || next_move >= move_count) {
+            return std::nullopt;
+        }
+        const int i = next_move++;
+        return SplitMove{moves[i], first_index + i, alpha};
+    }
+
+    // Records the score of a searched move with the line below it. Returns whether it cut off.
+    bool report(const Move& move, int score, std::span<const Move> child_line) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (cutoff) {
+            return false;
+        }
+        if (score > best_score) {
+            best_score = score;
+            best_move  = move;
+            if (score > alpha) {
+                alpha = score;
+                principal_variation.assign(1, move);
+                principal_variation.insert(principal_variation.end(), child_line.begin(),
+                                           child_line.end());
+            }
+        }
+        if (alpha >= beta) {
+            cutoff = true;
+            stop.request_stop();
+            return true;
+        }
+        return false;
+    }
+
+    void markInterrupted() {
+        const std::lock_guard<std::mutex> lock(mutex);
+        interrupted = true;
+    }
+
+    // Whether the moves of the split point were all searched or one of them cut off.
+    [[nodiscard]] bool completed() {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return cutoff || ! interrupted;
+    }
+
+    void leave() {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (--helpers == 0) {
+            helpers_done.notify_all();
+        }
+    }
+
+    void waitForHelpers() {
+        std::unique_lock<std::mutex> lock(mutex);
+        helpers_done.wait(lock, [this] { return helpers == 0; });
+    }
+};
+
+/// @brief Split points open for helpers, and the helpers waiting for one.
+///
+/// Only helpers of a YBWC search wait here, so in any other search no node ever sees an idle
+/// helper and none is split.
+class SplitPointQueue {
+    std::mutex                  mutex_;
+    std::condition_variable_any work_available_;
+    std::vector<SplitPoint*>    open_;
+    std::atomic<int>            idle_helpers_{0};
+
+public:
+    [[nodiscard]] bool hasIdleHelper() const noexcept {
+        return idle_helpers_.load(std::memory_order_relaxed) > 0;
+    }
+
+    void open(SplitPoint& split) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            open_.push_back(&split);
+        }
+        work_available_.notify_all();
+    }
+
+    // After this no helper joins the split point any more.
+    void close(SplitPoint& split) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        std::erase(open_, &split);
+    }
+
+    /// @brief Waits until a split point has moves left and joins it, or returns nullptr once st
+    /// is stopped. A joined split point must be left with SplitPoint::leave().
+    [[nodiscard]] SplitPoint* waitAndJoin(std::stop_token st) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_helpers_.fetch_add(1, std::memory_order_relaxed);
+        SplitPoint* joined = nullptr;
+        work_available_.wait(lock, st, [&] {
+            for (SplitPoint* split : open_) {
+                const std::lock_guard<std::mutex> split_lock(split->mutex);
+                if (! split->cutoff && split->next_move < split->move_count) {
+                    ++split->helpers;
+                    joined = split;
+                    return true;
+                }
+            }
+            return false;
+        });
+        idle_helpers_.fetch_sub(1, std::memory_order_relaxed);
+        return joined;
+    }
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_SPLIT_POINT_HPP
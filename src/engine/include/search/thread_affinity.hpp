@@ -0,0 +1,252 @@
+#ifndef BITCRUSHER_THREAD_AFFINITY_HPP
+#define BITCRUSHER_THREAD_AFFINITY_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#    include <sched.h>
+#    include <unistd.h>
+#endif
+
+namespace bitcrusher {
+
+// Where search threads run.
+enum class ThreadBinding : std::uint8_t {
+    NONE,     // Left to the OS scheduler.
+    NUMA,     // Round-robin over the NUMA nodes.
+    CPU_LIST, // Thread i on the i-th CPU of a user list, wrapping around.
+};
+
+[[nodiscard]] constexpr std::string_view toString(ThreadBinding binding) noexcept {
+    switch (binding) {
+    case ThreadBinding::NUMA:
+        return "numa";
+    case ThreadBinding::CPU_LIST:
+        return "cpus";
+    default:
+        return "none";
+    }
+}
+
+/// @brief Parses a Linux CPU list such as "0-3,8,10-11", the format of
+/// /sys/devices/system/node/node0/cpulist. Returns nullopt if it is malformed or empty.
+[[nodiscard]] inline std::optional<std::vector<int>> parseCpuList(std::string_view list) {
+    const auto is_space = [](char c) { return c == ' ' || c == '\n' || c == '\t'; };
+    while (! list.empty() && is_space(list.front())) {
+        list.remove_prefix(1);
+    }
+    while (! list.empty() && is_space(list.back())) {
+        list.remove_suffix(1);
+    }
+    const auto parse_cpu = [](std::string_view text) -> std::optional<int> {
+        int cpu = 0;
+
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), cpu);
+        if (ec != std::errc{} || ptr != text.data() + text.size() || cpu < 0) {
+            return std::nullopt;
+        }
+        return cpu;
+    };
+
+    std::vector<int> cpus;
+    while (! list.empty()) {
+        const std::size_t      comma = list.find(',');
+        const std::string_view range = list.substr(0, comma);
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+        const std::size_t        dash  = range.find('-');
+        const std::optional<int> first = parse_cpu(range.substr(0, dash));
+        const std::optional<int> last =
+            dash == std::string_view::npos ? first : parse_cpu(range.substr(dash + 1));
+        if (! first || ! last || *last < *first) {
+            return std::nullopt;
+        }
+        for (int cpu = *first; cpu <= *last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.empty()) {
+        return std::nullopt;
+    }
+    return cpus;
+}
+
+/// @brief One CPU per search thread in turn: the first CPU of every node, then the second of
+/// every node and so on, so consecutive threads are spread over the nodes' memory controllers.
+/// Nodes list their physical cores before the SMT siblings, which therefore come last.
+[[nodiscard]] inline std::vector<int> interleaveNodes(std::span<const std::vector<int>> nodes) {
+    std::vector<int> cpus;
+    for (std::size_t i = 0;; ++i) {
+        const std::size_t found = cpus.size();
+        for (const std::vector<int>& node : nodes) {
+            if (i < node.size()) {
+                cpus.push_back(node[i]);
+            }
+        }
+        if (cpus.size() == found) {
+            return cpus;
+        }
+    }
+}
+
+// CPUs the process may run on, as given to its main thread, in ascending order.
+[[nodiscard]] inline const std::vector<int>& processCpus() {
+    static const std::vector<int> cpus = [] {
+        std::vector<int> allowed;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(getpid(), sizeof(set), &set) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &set)) {
+                    allowed.push_back(cpu);
+                }
+            }
+        }
+#endif
+        return allowed;
+    }();
+    return cpus;
+}
+
+/// @brief CPUs of every NUMA node, in node order, restricted to the CPUs the process may use.
+/// Nodes left without any are dropped. A machine without NUMA information is one node.
+[[nodiscard]] inline std::vector<std::vector<int>> numaNodeCpus() {
+    namespace fs = std::filesystem;
+    const std::vector<int>&                       allowed = processCpus();
+    std::vector<std::pair<int, std::vector<int>>> nodes; // Node number and its CPUs.
+
+    std::error_code ec;
+    for (const fs::directory_entry& entry :
+         fs::directory_iterator("/sys/devices/system/node", ec)) {
+        const std::string name = entry.path().filename().string();
+        int               node = 0;
+        if (! name.starts_with("node") ||
+            std::from_chars(name.data() + 4, name.data() + name.size(), node).ptr !=
+                name.data() + name.size()) {
+            continue;
+        }
+        std::ifstream file(entry.path() / "cpulist");
+        std::string   list;
+        std::getline(file, list);
+        const std::optional<std::vector<int>> cpus = parseCpuList(list);
+        if (! cpus) {
+            continue;
+        }
+        std::vector<int> usable;
+        std::ranges::copy_if(*cpus, std::back_inserter(usable), [&](int cpu) {
+            return std::ranges::binary_search(allowed, cpu);
+        });
+        if (! usable.empty()) {
+            nodes.emplace_back(node, std::move(usable));
+        }
+    }
+    std::ranges::sort(nodes, {}, &std::pair<int, std::vector<int>>::first);
+
+    std::vector<std::vector<int>> node_cpus;
+    for (auto& node : nodes) {
+        node_cpus.push_back(std::move(node.second));
+    }
+    if (node_cpus.empty() && ! allowed.empty()) {
+        node_cpus.push_back(allowed);
+    }
+    return node_cpus;
+}
+
+/// @brief The CPU each search thread is pinned to.
+///
+/// A thread binds itself when its search starts, before it allocates its own search state, so
+/// with Linux's first-touch placement its move sink, history tables and stack pages come from its
+/// own node. State shared by the threads is not moved by binding. Only Linux supports binding;
+/// elsewhere every thread stays unbound.
+class ThreadAffinity {
+public:
+    ThreadAffinity() = default; // No binding.
+
+    [[nodiscard]] static ThreadAffinity numa() {
+        const std::vector<std::vector<int>> nodes = numaNodeCpus();
+        if (nodes.empty()) {
+            return {};
+        }
+        return {ThreadBinding::NUMA, interleaveNodes(nodes), static_cast<int>(nodes.size())};
+    }
+
+    // Returns nullopt for a malformed list or one naming CPUs the process may not run on.
+    [[nodiscard]] static std::optional<ThreadAffinity> cpuList(std::string_view list) {
+        std::optional<std::vector<int>> cpus = parseCpuList(list);
+        if (! cpus || ! std::ranges::all_of(*cpus, [](int cpu) {
+                return std::ranges::binary_search(processCpus(), cpu);
+            })) {
+            return std::nullopt;
+        }
+        return ThreadAffinity{ThreadBinding::CPU_LIST, std::move(*cpus), 0};
+    }
+
+    [[nodiscard]] ThreadBinding binding() const noexcept { return binding_; }
+
+    [[nodiscard]] std::span<const int> cpus() const noexcept { return cpus_; }
+
+    // Nodes a NUMA binding spreads threads over, 0 for any other binding.
+    [[nodiscard]] int nodeCount() const noexcept { return node_count_; }
+
+    [[nodiscard]] std::optional<int> cpuOf(int thread_index) const noexcept {
+        if (cpus_.empty()) {
+            return std::nullopt;
+        }
+        return cpus_[static_cast<std::size_t>(thread_index) % cpus_.size()];
+    }
+
+    /// @brief Pins the calling thread to the CPU of search thread thread_index. Without a binding
+    /// a thread pinned by an earlier search may run on any CPU of the process again. Returns
+    /// whether the thread now runs where this affinity says.
+    bool bindCurrentThread(int thread_index) const {
+#if defined(__linux__)
+        thread_local bool pinned = false;
+        cpu_set_t         set;
+        CPU_ZERO(&set);
+        if (const std::optional<int> cpu = cpuOf(thread_index)) {
+            if (*cpu >= CPU_SETSIZE) {
+                return false;
+            }
+            CPU_SET(*cpu, &set);
+        } else if (pinned) {
+            for (const int cpu : processCpus()) {
+                CPU_SET(cpu, &set);
+            }
+        } else {
+            return true;
+        }
+        const bool bound = sched_setaffinity(0, sizeof(set), &set) == 0;
+        if (bound) {
+            pinned = binding_ != ThreadBinding::NONE;
+        }
+        return bound;
+#else
+        return cpus_.empty();
+#endif
+    }
+
+private:
+    ThreadBinding    binding_{ThreadBinding::NONE};
+    std::vector<int> cpus_;
+    int              node_count_{0};
+
+    ThreadAffinity(ThreadBinding binding, std::vector<int> cpus, int node_count)
+        : binding_(binding), cpus_(std::move(cpus)), node_count_(node_count) {}
+};
+
+} // namespace bitcrusher
+
+#endif // BITCRUSHER_THREAD_AFFINITY_HPP
@@ -1,14 +1,26 @@
 #ifndef BITCRUSHER_TRANSPOSITION_TABLE_HPP
 #define BITCRUSHER_TRANSPOSITION_TABLE_HPP
 
+#include "large_page_buffer.hpp"
 #include "move.hpp"
+#include "search_statistics.hpp"
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <bit>
 #include <cassert>
+#include <constants.hpp>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 // _mm_prefetch: in <intrin.h> on MSVC/ICC, in <xmmintrin.h> on GCC/Clang.
 #if defined(_MSC_VER) || defined(__INTEL_COMPILER)
 #    include <intrin.h>
@@ -23,72 +35,284 @@ inline constexpr int ON_EVALUATION                    = 1000000 + 2;
 
 enum class TranspositionTableEvaluationType : std::uint8_t { EXACT_VALUE, LOWERBOUND, UPPERBOUND };
 
-const int DEFAULT_TT_SIZE = 1 << 20; // Must be a power of 2.
+inline constexpr int TT_ENTRIES_PER_BUCKET = 6;
+inline constexpr int TT_BUCKET_BYTES       = CACHE_LINE_SIZE;
 
+const int DEFAULT_TT_SIZE = 1 << 18; // Number of buckets. Must be a power of 2.
+
+inline constexpr size_t TT_HASHFULL_SAMPLE_BUCKETS = 1000;
+
+// Packed scores are 16-bit. Mate scores are stored as distance to mate from the node that stored
+// them (not from the root) so they stay correct when the entry is probed at a different ply.
+inline constexpr int TT_MATE_VALUE     = 32000;
+inline constexpr int TT_MATE_THRESHOLD = TT_MATE_VALUE - (CHECKMATE_BASE - CHECKMATE_THRESHOLD);
+inline constexpr int TT_NO_EVAL        = -TT_MATE_VALUE - 1;
+
+// The generation occupies the upper 6 bits of gen_bound and advances once per search, so entries
+// left over from earlier searches can be told apart and replaced first.
+inline constexpr uint8_t TT_BOUND_MASK       = 0x3;
+inline constexpr uint8_t TT_GENERATION_DELTA = TT_BOUND_MASK + 1;
+inline constexpr uint8_t TT_GENERATION_MASK  = static_cast<uint8_t>(~TT_BOUND_MASK);
+inline constexpr int     TT_GENERATION_CYCLE = UINT8_MAX + TT_GENERATION_DELTA;
+
+// Stored depth is offset so that quiescence entries (depth <= 0) fit in a byte and 0 can mark an
+// empty slot.
+inline constexpr int TT_DEPTH_OFFSET = -8;
+inline constexpr int TT_MAX_DEPTH    = UINT8_MAX + TT_DEPTH_OFFSET;
+
+[[nodiscard]] constexpr int16_t packScore(int score, int ply) noexcept {
+    if (score >= CHECKMATE_THRESHOLD) {
+        const int distance_from_node = std::max(0, CHECKMATE_BASE - score - ply);
+        return static_cast<int16_t>(TT_MATE_VALUE - distance_from_node);
+    }
+    if (score <= -CHECKMATE_THRESHOLD) {
+        const int distance_from_node = std::max(0, CHECKMATE_BASE + score - ply);
+        return static_cast<int16_t>(-TT_MATE_VALUE + distance_from_node);
+    }
+    return static_cast<int16_t>(std::clamp(score, -TT_MATE_THRESHOLD + 1, TT_MATE_THRESHOLD - 1));
+}
+
+[[nodiscard]] constexpr int unpackScore(int16_t packed, int ply) noexcept {
+    if (packed >= TT_MATE_THRESHOLD) {
+        return CHECKMATE_BASE - (TT_MATE_VALUE - packed) - ply;
+    }
+    if (packed <= -TT_MATE_THRESHOLD) {
+        return -CHECKMATE_BASE + (TT_MATE_VALUE + packed) + ply;
+    }
+    return packed;
+}
+
+// Unpacked view of a table slot, returned by getEntry().
 struct TranspositionTableEntry {
-    uint64_t                         key{0ULL};
     int                              depth{-1};
     int                              value{NOT_FOUND_IN_TRANSPOSITION_TABLE};
+    int                              static_eval{TT_NO_EVAL};
     TranspositionTableEvaluationType evaluation_type{TranspositionTableEvaluationType::EXACT_VALUE};
-    Move                             best_move = Move::none();
+    PackedMove                       best_move{PACKED_MOVE_NONE};
+
+    [[nodiscard]] bool found() const noexcept { return value != NOT_FOUND_IN_TRANSPOSITION_TABLE; }
 };
 
+// Table slot payload. It fits in one 64-bit word so it is always read and written whole. The
+// bucket index already encodes the low bits of the Zobrist key; the top 16 bits are kept next to
+// the word for verification (see TranspositionTableBucket).
+struct PackedTranspositionTableEntry {
+    PackedMove move{PACKED_MOVE_NONE};
+    int16_t    value{0};
+    int16_t    static_eval{0};
+    uint8_t    depth8{0};    // Depth - TT_DEPTH_OFFSET, 0 marks an empty slot.
+    uint8_t    gen_bound{0}; // Bits 0-1: evaluation type, bits 2-7: search generation.
+
+    [[nodiscard]] bool isEmpty() const noexcept { return depth8 == 0; }
+
+    [[nodiscard]] TranspositionTableEvaluationType evaluationType() const noexcept {
+        return static_cast<TranspositionTableEvaluationType>(gen_bound & TT_BOUND_MASK);
+    }
+
+    // Number of searches since this entry was written, in units of TT_GENERATION_DELTA.
+    [[nodiscard]] int relativeAge(uint8_t generation) const noexcept {
+        return (TT_GENERATION_CYCLE + generation - gen_bound) & TT_GENERATION_MASK;
+    }
+
+    // Lower is a better replacement candidate: shallow and stale entries go first.
+    [[nodiscard]] int replacementScore(uint8_t generation) const noexcept {
+        return depth8 - (2 * relativeAge(generation));
+    }
+};
+
+static_assert(sizeof(PackedTranspositionTableEntry) == sizeof(uint64_t));
+static_assert(std::is_trivially_copyable_v<PackedTranspositionTableEntry>);
+
+// Structure-of-arrays bucket: six payload words followed by their six verification keys.
+//
+// Each key is stored XOR-ed with a 16-bit fold of its payload word (Hyatt's lockless hashing).
+// Words and keys are plain integers accessed through relaxed std::atomic_ref, so there is no data
+// race and every load sees one whole write. A reader that catches a key from one store and a
+// payload from another recomputes a key that does not match, and treats the slot as a miss
+// instead of returning a value and move that belong to different positions.
+struct alignas(TT_BUCKET_BYTES) TranspositionTableBucket {
+    std::array<uint64_t, TT_ENTRIES_PER_BUCKET> data{};
+    std::array<uint16_t, TT_ENTRIES_PER_BUCKET> keys{};
+};
+
+static_assert(sizeof(TranspositionTableBucket) == TT_BUCKET_BYTES);
+static_assert(std::is_trivially_copyable_v<TranspositionTableBucket>);
+
+// Saved table layout: this header followed by the raw buckets, in host byte order.
+inline constexpr std::array<char, 8> TT_FILE_MAGIC{'B', 'C', 'T', 'T', 'A', 'B', 'L', 'E'};
+inline constexpr uint32_t            TT_FILE_VERSION = 1;
+
+struct TranspositionTableFileHeader {
+    std::array<char, 8>    magic{TT_FILE_MAGIC};
+    uint32_t               version{TT_FILE_VERSION};
+    uint32_t               bucket_bytes{sizeof(TranspositionTableBucket)};
+    uint64_t               bucket_count{0};
+    uint64_t               zobrist_seed{0};
+    uint8_t                generation{0};
+    std::array<uint8_t, 7> reserved{};
+};
+
+static_assert(sizeof(TranspositionTableFileHeader) == 40);
+
+enum class TranspositionTableFileStatus : std::uint8_t {
+    OK,
+    CANNOT_OPEN,
+    INCOMPATIBLE, // Different format version, bucket layout or Zobrist seed.
+    CORRUPTED,    // Bad header or size does not match the header.
+};
+
+[[nodiscard]] constexpr std::string_view toString(TranspositionTableFileStatus status) noexcept {
+    switch (status) {
+    case TranspositionTableFileStatus::OK:
+        return "ok";
+    case TranspositionTableFileStatus::CANNOT_OPEN:
+        return "cannot open file";
+    case TranspositionTableFileStatus::INCOMPATIBLE:
+        return "incompatible file";
+    default:
+        return "corrupted file";
+    }
+}
+
+// Runs task(slice) for every slice in [0, slices), each on its own thread, and returns once all
+// of them have finished. Supplied by the owner of the search threads.
+using ParallelSlices = std::function<void(int slices, const std::function<void(int)>& task)>;
+
 class TranspositionTable {
-    std::vector<TranspositionTableEntry> table_;
-    // Separate from the entry so the main entry stays trivially copyable and racy
-    // reads remain safe. Atomic so add/remove/isSearched are data-race-free.
-    std::vector<std::atomic<uint8_t>> searching_by_;
+    LargePageBuffer           memory_;
+    TranspositionTableBucket* table_{nullptr};
+    size_t                    bucket_count_{0};
 
     uint64_t mask_{DEFAULT_TT_SIZE - 1};
+    uint8_t  generation_{0};
 
     [[nodiscard]] uint64_t indexForKey(uint64_t key) const { return key & mask_; }
 
-#ifdef DEBUG
-    std::atomic<int> used_{0};
-#endif
+    [[nodiscard]] static uint16_t verificationKey(uint64_t key) {
+        return static_cast<uint16_t>(key >> 48);
+    }
+
+    [[nodiscard]] static uint16_t fold(uint64_t word) {
+        return static_cast<uint16_t>(word ^ (word >> 16) ^ (word >> 32) ^ (word >> 48));
+    }
+
+    // One consistent slot snapshot. matches() is false for empty and for torn slots.
+    struct Slot {
+        PackedTranspositionTableEntry entry;
+        uint16_t                      key16{0};
+
+        [[nodiscard]] bool matches(uint16_t key) const noexcept {
+            return key16 == key && ! entry.isEmpty();
+        }
+    };
+
+    [[nodiscard]] static Slot loadSlot(TranspositionTableBucket& bucket, int index) {
+        const uint64_t word = std::atomic_ref(bucket.data[index]).load(std::memory_order_relaxed);
+        const uint16_t key  = std::atomic_ref(bucket.keys[index]).load(std::memory_order_relaxed);
+        return {std::bit_cast<PackedTranspositionTableEntry>(word),
+                static_cast<uint16_t>(key ^ fold(word))};
+    }
+
+    static void storeSlot(TranspositionTableBucket&            bucket,
+                          int                                  index,
+                          const PackedTranspositionTableEntry& entry,
+                          uint16_t                             key16) {
+        const auto word = std::bit_cast<uint64_t>(entry);
+        std::atomic_ref(bucket.data[index]).store(word, std::memory_order_relaxed);
+        std::atomic_ref(bucket.keys[index]).store(key16 ^ fold(word), std::memory_order_relaxed);
+    }
 
 public:
-    TranspositionTable() : table_(DEFAULT_TT_SIZE), searching_by_(DEFAULT_TT_SIZE) {}
+    TranspositionTable() { setSize(DEFAULT_TT_SIZE); }
 
     // Determine the bound type from the search window and store the entry.
-    void
-    storeBounded(uint64_t key, int score, Move best_move, int depth, int alpha_orig, int beta) {
-        TranspositionTableEntry entry;
-        entry.key       = key;
-        entry.value     = score;
-        entry.best_move = best_move;
-        entry.depth     = depth;
-        if (score <= alpha_orig)
-            entry.evaluation_type = TranspositionTableEvaluationType::UPPERBOUND;
-        else if (score >= beta)
-            entry.evaluation_type = TranspositionTableEvaluationType::LOWERBOUND;
-        else {
-            entry.evaluation_type = TranspositionTableEvaluationType::EXACT_VALUE;
+    void storeBounded(uint64_t key,
+                      int      score,
+                      Move     best_move,
+                      int      depth,
+                      int      alpha_orig,
+                      int      beta,
+                      int      ply,
+                      int      static_eval = TT_NO_EVAL) {
+        TranspositionTableEvaluationType evaluation_type =
+            TranspositionTableEvaluationType::EXACT_VALUE;
+        if (score <= alpha_orig) {
+            evaluation_type = TranspositionTableEvaluationType::UPPERBOUND;
+        } else if (score >= beta) {
+            evaluation_type = TranspositionTableEvaluationType::LOWERBOUND;
         }
-        store(key, entry);
-    }
-
-    // Lock-free: racy reads/writes are intentional. The TT is a cache a torn
-    // read produces an entry whose key won't match the position hash, so it is
-    // silently treated as a miss.
-    void store(uint64_t key, TranspositionTableEntry entry) {
-        assert(entry.value != ON_EVALUATION);
-        const uint64_t                 index         = indexForKey(key);
-        const TranspositionTableEntry& current_entry = table_[index];
-
-        // Replace if closer to root or more recent.
-        if (entry.depth >= current_entry.depth) {
-#ifdef DEBUG
-            if (current_entry.depth == -1) {
-                used_.fetch_add(1, std::memory_order_relaxed);
+        store(key, score, packMove(best_move), depth, evaluation_type, ply, static_eval);
+    }
+
+    // Lock-free, see TranspositionTableBucket for how concurrent writers are kept apart.
+    void store(uint64_t                         key,
+               int                              score,
+               PackedMove                       best_move,
+               int                              depth,
+               TranspositionTableEvaluationType evaluation_type,
+               int                              ply,
+               int                              static_eval = TT_NO_EVAL) {
+        assert(score != ON_EVALUATION);
+        TranspositionTableBucket& bucket = table_[indexForKey(key)];
+        const uint16_t            key16  = verificationKey(key);
+        const int                 depth8 = std::clamp(depth, TT_DEPTH_OFFSET + 1, TT_MAX_DEPTH) -
+                                           TT_DEPTH_OFFSET;
+
+        // Prefer the slot already holding this position, otherwise the shallowest and oldest one.
+        int  replace_index = 0;
+        Slot replace       = loadSlot(bucket, 0);
+        for (int i = 0; i < TT_ENTRIES_PER_BUCKET; ++i) {
+            const Slot slot = loadSlot(bucket, i);
+            if (slot.matches(key16)) {
+                replace_index = i;
+                replace       = slot;
+                break;
             }
-#endif
-            table_[index] = entry;
+            if (slot.entry.replacementScore(generation_) <
+                replace.entry.replacementScore(generation_)) {
+                replace_index = i;
+                replace       = slot;
+            }
+        }
+
+        const bool same_position = replace.matches(key16);
+        // Keep a deeper result for the same position from this search unless the new one is exact.
+        if (same_position && evaluation_type != TranspositionTableEvaluationType::EXACT_VALUE &&
+            replace.entry.relativeAge(generation_) == 0 && depth8 + 2 < replace.entry.depth8) {
+            return;
         }
+        ++thread_search_statistics.tt_stores;
+        if (! same_position && ! replace.entry.isEmpty()) {
+            ++thread_search_statistics.tt_replacements;
+        }
+        PackedTranspositionTableEntry entry;
+        entry.move        = (best_move == PACKED_MOVE_NONE && same_position) ? replace.entry.move
+                                                                             : best_move;
+        entry.value       = packScore(score, ply);
+        entry.static_eval = static_cast<int16_t>(static_eval);
+        entry.depth8      = static_cast<uint8_t>(depth8);
+        entry.gen_bound   = static_cast<uint8_t>(generation_ | std::to_underlying(evaluation_type));
+        storeSlot(bucket, replace_index, entry, key16);
     }
 
-    [[nodiscard]] TranspositionTableEntry getEntry(uint64_t key) {
-        return table_[indexForKey(key)];
+    [[nodiscard]] TranspositionTableEntry getEntry(uint64_t key, int ply) const {
+        TranspositionTableBucket& bucket = table_[indexForKey(key)];
+        const uint16_t            key16  = verificationKey(key);
+        ++thread_search_statistics.tt_probes;
+        for (int i = 0; i < TT_ENTRIES_PER_BUCKET; ++i) {
+            const Slot slot = loadSlot(bucket, i);
+            if (slot.matches(key16)) {
+                ++thread_search_statistics.tt_hits;
+                TranspositionTableEntry entry;
+                entry.depth           = slot.entry.depth8 + TT_DEPTH_OFFSET;
+                entry.value           = unpackScore(slot.entry.value, ply);
+                entry.static_eval     = slot.entry.static_eval;
+                entry.evaluation_type = slot.entry.evaluationType();
+                entry.best_move       = slot.entry.move;
+                return entry;
+            }
+        }
+        return {};
     }
 
     void prefetch(uint64_t key) const {
@@ -96,55 +320,150 @@ public:
                      _MM_HINT_T0); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     }
 
-    void addSearched(uint64_t key) {
-        searching_by_[indexForKey(key)].fetch_add(1, std::memory_order_relaxed);
-    }
-
-    void removeSearched(uint64_t key) {
-        searching_by_[indexForKey(key)].fetch_sub(1, std::memory_order_relaxed);
-    }
-
-    bool isSearched(uint64_t key) {
-        return searching_by_[indexForKey(key)].load(std::memory_order_relaxed) > 0;
-    }
-
-    void setMBSize(size_t size) {
+    void setMBSize(size_t size, int thread_count = 1, const ParallelSlices& parallel = {}) {
         constexpr std::size_t BYTES_PER_KILOBYTE     = 1024ULL;
         constexpr std::size_t KILOBYTES_PER_MEGABYTE = 1024ULL;
         const size_t target_memory_bytes = size * KILOBYTES_PER_MEGABYTE * BYTES_PER_KILOBYTE;
-        const size_t object_size         = sizeof(TranspositionTableEntry);
+        const size_t object_size         = sizeof(TranspositionTableBucket);
         const size_t num_objects         = target_memory_bytes / object_size;
-        setSize(num_objects);
+        setSize(num_objects, thread_count, parallel);
     }
 
-    void setSize(size_t size) {
+    // Size in buckets, each holding TT_ENTRIES_PER_BUCKET entries.
+    void setSize(size_t size, int thread_count = 1, const ParallelSlices& parallel = {}) {
+        // Free the old table first, so memory never holds both.
+        memory_       = LargePageBuffer();
+        table_        = nullptr;
+        bucket_count_ = 0;
         // Round up to next power of 2 so indexForKey can use a bitmask.
         const size_t pow2 = std::bit_ceil(size);
         mask_             = pow2 - 1;
-        table_.assign(pow2, TranspositionTableEntry{});
-        table_.shrink_to_fit();
-        searching_by_ = std::vector<std::atomic<uint8_t>>(pow2);
+        memory_           = LargePageBuffer(pow2 * sizeof(TranspositionTableBucket));
+        table_            = static_cast<TranspositionTableBucket*>(memory_.data());
+        bucket_count_     = pow2;
+        clear(thread_count, parallel);
+    }
+
+    [[nodiscard]] LargePageStatus getLargePageStatus() const { return memory_.status(); }
+
+    // Writes the whole table. Must not run concurrently with a search. The file is written under
+    // a per-thread temporary name and renamed, so readers and other writers never see a partial
+    // table.
+    [[nodiscard]] TranspositionTableFileStatus save(const std::filesystem::path& path,
+                                                    uint64_t zobrist_seed) const {
+        std::filesystem::path temporary_path = path;
+        temporary_path +=
+            std::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+            if (! file.is_open()) {
+                return TranspositionTableFileStatus::CANNOT_OPEN;
+            }
+            TranspositionTableFileHeader header;
+            header.bucket_count = bucket_count_;
+            header.zobrist_seed = zobrist_seed;
+            header.generation   = generation_;
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(table_),
+                       static_cast<std::streamsize>(bucket_count_ *
+                                                    sizeof(TranspositionTableBucket)));
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            if (! file.flush()) {
+                return TranspositionTableFileStatus::CANNOT_OPEN;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary_path, path, error);
+        return error ? TranspositionTableFileStatus::CANNOT_OPEN : TranspositionTableFileStatus::OK;
     }
 
-    void clear() {
-        std::ranges::fill(table_, TranspositionTableEntry{});
-        for (auto& s : searching_by_) {
-            s.store(0, std::memory_order_relaxed);
+    // Replaces the table with a saved one, taking over its size. On failure the table is left
+    // unchanged, or empty when the file turns out to be short after resizing.
+    [[nodiscard]] TranspositionTableFileStatus
+    load(const std::filesystem::path& path,
+         uint64_t                     zobrist_seed,
+         int                          thread_count = 1,
+         const ParallelSlices&        parallel     = {}) {
+        std::ifstream file(path, std::ios::binary);
+        if (! file.is_open()) {
+            return TranspositionTableFileStatus::CANNOT_OPEN;
         }
-#ifdef DEBUG
-        used_.store(0);
-#endif
+        TranspositionTableFileHeader header;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (! file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.magic != TT_FILE_MAGIC || ! std::has_single_bit(header.bucket_count)) {
+            return TranspositionTableFileStatus::CORRUPTED;
+        }
+        if (header.version != TT_FILE_VERSION ||
+            header.bucket_bytes != sizeof(TranspositionTableBucket) ||
+            header.zobrist_seed != zobrist_seed) {
+            return TranspositionTableFileStatus::INCOMPATIBLE;
+        }
+        const uint64_t table_bytes = header.bucket_count * sizeof(TranspositionTableBucket);
+
+        std::error_code error;
+        if (std::filesystem::file_size(path, error) != sizeof(header) + table_bytes || error) {
+            return TranspositionTableFileStatus::CORRUPTED;
+        }
+
+        // Allocate and first-touch on the search threads before filling the table.
+        setSize(header.bucket_count, thread_count, parallel);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (! file.read(reinterpret_cast<char*>(table_), static_cast<std::streamsize>(table_bytes))) {
+            clear(thread_count, parallel);
+            return TranspositionTableFileStatus::CORRUPTED;
+        }
+        generation_ = header.generation;
+        return TranspositionTableFileStatus::OK;
     }
 
-#ifdef DEBUG
-    double getUsedPercentage() const {
-        size_t size = table_.size();
-        return size > 0 ? (static_cast<double>(used_.load()) / static_cast<double>(size)) * 100.0
-                        : 0.0;
+    // Called at the start of every search. Entries from earlier searches stay usable but become
+    // preferred victims for replacement, so the table does not need clearing between moves.
+    void newSearch() { generation_ += TT_GENERATION_DELTA; }
+
+    [[nodiscard]] size_t getEntryCount() const { return bucket_count_ * TT_ENTRIES_PER_BUCKET; }
+
+    // Zeroing is split into thread_count slices, run by parallel when given. Each of its threads
+    // is the first to touch its slice, so on NUMA machines the pages end up spread across the
+    // nodes the threads run on. Without it the calling thread zeroes every slice.
+    void clear(int thread_count = 1, const ParallelSlices& parallel = {}) {
+        const size_t slices = std::clamp<size_t>(thread_count, 1, bucket_count_);
+
+        auto zero_slice = [this, slices](int slice) {
+            const size_t begin = bucket_count_ * slice / slices;
+            const size_t end   = bucket_count_ * (slice + 1) / slices;
+            std::memset(static_cast<void*>(table_ + begin), 0,
+                        (end - begin) * sizeof(TranspositionTableBucket));
+        };
+
+        if (parallel && slices > 1) {
+            parallel(static_cast<int>(slices), zero_slice);
+        } else {
+            for (size_t slice = 0; slice < slices; ++slice) {
+                zero_slice(static_cast<int>(slice));
+            }
+        }
+        generation_ = 0;
+    }
+
+    // Permille of entries written during the current search, for UCI "info hashfull". Only the
+    // first TT_HASHFULL_SAMPLE_BUCKETS buckets are read, so it is cheap enough for every info line.
+    [[nodiscard]] int hashfull() const {
+        const size_t sample = std::min<size_t>(bucket_count_, TT_HASHFULL_SAMPLE_BUCKETS);
+        size_t       used   = 0;
+        for (size_t i = 0; i < sample; ++i) {
+            for (int slot = 0; slot < TT_ENTRIES_PER_BUCKET; ++slot) {
+                const PackedTranspositionTableEntry entry = loadSlot(table_[i], slot).entry;
+                if (! entry.isEmpty() && entry.relativeAge(generation_) == 0) {
+                    ++used;
+                }
+            }
+        }
+        return static_cast<int>(used * 1000 / (sample * TT_ENTRIES_PER_BUCKET));
     }
-#endif
 };
 
 } // namespace bitcrusher
 
-#endif // BITCRUSHER_TRANSPOSITION_TABLE_HPP
\ No newline at end of file
+#endif // BITCRUSHER_TRANSPOSITION_TABLE_HPP
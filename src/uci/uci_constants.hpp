@@ -5,6 +5,7 @@
 #include <format>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace bitcrusher {
 
@@ -24,13 +25,51 @@ struct UciSpinOption {
     }
 };
 
+struct UciComboOption {
+    std::string              name;
+    std::string              default_value;
+    std::vector<std::string> values;
+
+    [[nodiscard]] std::string toString() const {
+        std::string option =
+            std::format("option name {} type combo default {}", name, default_value);
+        for (const std::string& value : values) {
+            option += std::format(" var {}", value);
+        }
+        return option + "\n";
+    }
+};
+
+struct UciStringOption {
+    std::string name;
+    std::string default_value;
+
+    [[nodiscard]] std::string toString() const {
+        return std::format("option name {} type string default {}\n", name, default_value);
+    }
+};
+
 inline UciSpinOption THREADS{
     .name = "Threads", .default_value = 1, .min_value = 1, .max_value = 1024};
 
 // The value for memory of hash table in MB.
 inline UciSpinOption HASH{.name = "Hash", .default_value = 32, .min_value = 1, .max_value = 1024};
 
-inline std::string OPTIONS = THREADS.toString() + HASH.toString();
+// The value for memory of the evaluation cache in MB.
+inline UciSpinOption EVAL_CACHE{
+    .name = "EvalCache", .default_value = 2, .min_value = 1, .max_value = 256};
+
+// How several threads share a search: Lazy SMP over the shared hash table, or Young Brothers
+// Wait splitting of nodes between the threads.
+inline UciComboOption PARALLEL_SEARCH{
+    .name = "ParallelSearch", .default_value = "LazySMP", .values = {"LazySMP", "YBWC"}};
+
+// Pins search threads to CPUs on Linux: "none", "numa" for round-robin over the NUMA nodes, or a
+// CPU list such as "0-15,32-47" taken by the threads in order.
+inline UciStringOption THREAD_BINDING{.name = "ThreadBinding", .default_value = "none"};
+
+inline std::string OPTIONS = THREADS.toString() + HASH.toString() + EVAL_CACHE.toString() +
+                             PARALLEL_SEARCH.toString() + THREAD_BINDING.toString();
 } // namespace bitcrusher
 
 const int MILLISECONDS_PER_SECONDS = 1000;
@@ -8,9 +8,11 @@
 #include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace bitcrusher::uci {
 
@@ -34,16 +36,31 @@ public:
                                                             std::chrono::steady_clock::now());
             const uint64_t nps            = calculateNPS(node_count, search_time_ms);
             std::string    info =
-                std::format("info depth {} score {} nodes {} time {} nps {} pv {}", depth,
-                            search_manager_.getScore(), node_count, search_time_ms, nps,
-                            search_manager_.getPrincipalVariation(depth));
-#ifdef DEBUG
-            std::string debug_info = std::format(
-                " beta cutoffs {} tt cutoffs {} tt usage {}%", search_manager_.getBetaCutoffs(),
-                search_manager_.getTTCutoffs(), search_manager_.getTTUsage());
-            info += debug_info;
-#endif
+                std::format("info depth {} score {} nodes {} time {} nps {} hashfull {} pv {}",
+                            depth, search_manager_.getScore(), node_count, search_time_ms, nps,
+                            search_manager_.getHashfull(),
+                            search_manager_.getPrincipalVariation());
             send(info);
+            if (search_manager_.isDebug()) {
+                const SearchStatistics stats = search_manager_.getStatistics();
+                send(std::format("info string tt probes {} hits {:.1f}% collisions {:.2f}% "
+                                 "stores {} replacements {} tt cutoffs {} beta cutoffs {} "
+                                 "eval cache probes {} hits {:.1f}%",
+                                 stats.tt_probes, stats.ttHitRate(), stats.ttCollisionRate(),
+                                 stats.tt_stores, stats.tt_replacements, stats.tt_cutoffs,
+                                 stats.beta_cutoffs, stats.eval_cache_probes,
+                                 stats.evalCacheHitRate()));
+            }
+        });
+
+        search_manager_.setOnAspirationFailed([this](int depth, int score, ScoreBound bound) {
+            const uint64_t node_count     = search_manager_.getNodeCount();
+            const uint64_t search_time_ms = getSearchTimeMs(search_manager_.getSearchStartTime(),
+                                                            std::chrono::steady_clock::now());
+            send(std::format("info depth {} score {} {} nodes {} time {} nps {}", depth,
+                             SearchManager::formatScore(score),
+                             bound == ScoreBound::LOWER ? "lowerbound" : "upperbound", node_count,
+                             search_time_ms, calculateNPS(node_count, search_time_ms)));
         });
     }
 
@@ -134,12 +151,17 @@ private:
         } else if (command_token == "ucinewgame") {
             search_manager_.newGame();
         } else if (command_token == "debug") {
-            ++words_iter; // Skips over "name" token.
-            handleDebug(*words_iter);
+            if (words_iter != words_end_iter) {
+                handleDebug(*words_iter);
+            }
         } else if (command_token == "ponderhit") {
             handlePonderHit();
         } else if (command_token == "bench") {
             handleBench();
+        } else if (command_token == "savehash") {
+            handleSaveHash(words_iter, words_end_iter);
+        } else if (command_token == "loadhash") {
+            handleLoadHash(words_iter, words_end_iter);
         } else if (command_token == "quit") {
             exit(0);
         } else {
@@ -156,6 +178,14 @@ private:
             int hash_size = HASH.default_value;
             parseNumber(value, hash_size);
             search_manager_.setHashMBSize(hash_size);
+            send(std::format("info string Hash {} MB, large pages {}", hash_size,
+                             toString(search_manager_.getHashLargePageStatus())));
+        }
+        if (name == "EvalCache" || name == "evalcache") {
+            int eval_cache_size = EVAL_CACHE.default_value;
+            parseNumber(value, eval_cache_size);
+            search_manager_.setEvalCacheMBSize(eval_cache_size);
+            send(std::format("info string EvalCache {} MB", eval_cache_size));
         }
         if (name == "threads" || name == "Threads") {
             int cores_count = THREADS.default_value;
@@ -163,6 +193,80 @@ private:
             search_manager_.setMaxCores(cores_count);
             send(std::format("info string Using {} threads", cores_count));
         }
+        if (name == "ParallelSearch" || name == "parallelsearch") {
+            const bool ybwc = value == "YBWC" || value == "ybwc";
+            search_manager_.setParallelSearchMode(ybwc ? ParallelSearchMode::YBWC
+                                                       : ParallelSearchMode::LAZY_SMP);
+            send(std::format("info string ParallelSearch {}", ybwc ? "YBWC" : "LazySMP"));
+        }
+        if (name == "ThreadBinding" || name == "threadbinding") {
+            handleThreadBinding(value);
+        }
+    }
+
+    void handleThreadBinding(std::string_view value) {
+        if (value.empty() || value == "none" || value == "None") {
+            search_manager_.setThreadAffinity(ThreadAffinity{});
+            send("info string ThreadBinding none");
+            return;
+        }
+        if (value == "numa" || value == "NUMA") {
+            ThreadAffinity affinity = ThreadAffinity::numa();
+            if (affinity.binding() == ThreadBinding::NONE) {
+                send("info string ThreadBinding numa not supported, threads stay unbound");
+            } else {
+                send(std::format("info string ThreadBinding numa, {} nodes, {} cpus",
+                                 affinity.nodeCount(), affinity.cpus().size()));
+            }
+            search_manager_.setThreadAffinity(std::move(affinity));
+            return;
+        }
+        std::optional<ThreadAffinity> affinity = ThreadAffinity::cpuList(value);
+        if (! affinity) {
+            send(std::format("info string ThreadBinding invalid cpu list {}", value));
+            return;
+        }
+        send(std::format("info string ThreadBinding {} cpus", affinity->cpus().size()));
+        search_manager_.setThreadAffinity(std::move(*affinity));
+    }
+
+    // Rest of the command line, so file paths may contain spaces.
+    static std::string joinTokens(auto iter, auto end_iter) {
+        std::string joined;
+        for (; iter != end_iter; ++iter) {
+            if (! joined.empty()) {
+                joined += ' ';
+            }
+            joined += *iter;
+        }
+        return joined;
+    }
+
+    // Non-standard: "savehash <file>" dumps the transposition table for a later session.
+    void handleSaveHash(auto iter, auto end_iter) {
+        const std::string path = joinTokens(iter, end_iter);
+        if (path.empty()) {
+            send("info string savehash needs a file name");
+            return;
+        }
+        const TranspositionTableFileStatus status = search_manager_.saveHash(path);
+        send(std::format("info string savehash {}: {}", path, toString(status)));
+    }
+
+    // Non-standard: "loadhash <file>" replaces the transposition table with a saved one.
+    void handleLoadHash(auto iter, auto end_iter) {
+        const std::string path = joinTokens(iter, end_iter);
+        if (path.empty()) {
+            send("info string loadhash needs a file name");
+            return;
+        }
+        const TranspositionTableFileStatus status = search_manager_.loadHash(path);
+        if (status != TranspositionTableFileStatus::OK) {
+            send(std::format("info string loadhash {}: {}", path, toString(status)));
+            return;
+        }
+        send(std::format("info string loadhash {}: ok, Hash {} MB", path,
+                         search_manager_.getHashMBSize()));
     }
 
     static void handleUCI() { send(std::format("{}\n{}\nuciok", UCI_ID_STRING, OPTIONS)); }
@@ -230,7 +334,7 @@ private:
             } else if (option == "depth") {
                 int depth = 0;
                 parseNumber(*++iter, depth);
-                params.max_ply = depth * 2;
+                params.max_ply = depth;
             } else if (option == "nodes") {
                 parseNumber(*++iter, params.max_nodes);
             } else if (option == "mate") {
@@ -0,0 +1,63 @@
+#include "evaluation_cache.hpp"
+#include "search_statistics.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+
+using bitcrusher::EvaluationCache;
+using bitcrusher::thread_search_statistics;
+
+class EvaluationCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cache.setSize(1024);
+        thread_search_statistics = {};
+    }
+
+    EvaluationCache cache;
+};
+
+TEST_F(EvaluationCacheTest, StoredEvaluationIsFound) {
+    const uint64_t key = 0x1234'5678'9ABC'DEF0ULL;
+    EXPECT_FALSE(cache.probe(key).has_value());
+
+    cache.store(key, -57);
+    ASSERT_TRUE(cache.probe(key).has_value());
+    EXPECT_EQ(*cache.probe(key), -57);
+}
+
+TEST_F(EvaluationCacheTest, DifferentPositionInTheSameEntryIsAMiss) {
+    const uint64_t key   = 0x1234'5678'0000'0042ULL;
+    const uint64_t other = 0x8765'4321'0000'0042ULL; // Same index, different verification bits.
+    cache.store(key, 120);
+
+    EXPECT_FALSE(cache.probe(other).has_value());
+
+    cache.store(other, 35); // Replaces the older entry.
+    EXPECT_FALSE(cache.probe(key).has_value());
+    EXPECT_EQ(*cache.probe(other), 35);
+}
+
+TEST_F(EvaluationCacheTest, ClearRemovesEntries) {
+    const uint64_t key = 0xFEDC'BA98'7654'3210ULL;
+    cache.store(key, 10);
+    cache.clear();
+
+    EXPECT_FALSE(cache.probe(key).has_value());
+}
+
+TEST_F(EvaluationCacheTest, ProbesAndHitsAreCounted) {
+    const uint64_t key = 0x0F0F'0F0F'0F0F'0F0FULL;
+    (void)cache.probe(key);
+    cache.store(key, 1);
+    (void)cache.probe(key);
+
+    EXPECT_EQ(thread_search_statistics.eval_cache_probes, 2);
+    EXPECT_EQ(thread_search_statistics.eval_cache_hits, 1);
+    EXPECT_DOUBLE_EQ(thread_search_statistics.evalCacheHitRate(), 50.0);
+}
+
+TEST_F(EvaluationCacheTest, SetMBSizeRoundsToPowerOfTwoEntries) {
+    cache.setMBSize(1);
+
+    EXPECT_EQ(cache.getEntryCount(), 1024 * 1024 / sizeof(uint64_t));
+}
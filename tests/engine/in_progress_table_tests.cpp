@@ -0,0 +1,51 @@
+#include "in_progress_table.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+
+using bitcrusher::IN_PROGRESS_BUCKETS;
+using bitcrusher::IN_PROGRESS_WAYS;
+using bitcrusher::InProgressTable;
+
+class InProgressTableTest : public ::testing::Test {
+protected:
+    std::unique_ptr<InProgressTable> table = std::make_unique<InProgressTable>();
+};
+
+TEST_F(InProgressTableTest, EnteredPositionIsInProgressUntilLeft) {
+    EXPECT_FALSE(table->contains(42));
+
+    ASSERT_TRUE(table->enter(42));
+    EXPECT_TRUE(table->contains(42));
+
+    table->leave(42);
+    EXPECT_FALSE(table->contains(42));
+}
+
+TEST_F(InProgressTableTest, PositionStaysInProgressWhileAnotherThreadSearchesIt) {
+    ASSERT_TRUE(table->enter(42));
+    ASSERT_TRUE(table->enter(42));
+
+    table->leave(42);
+    EXPECT_TRUE(table->contains(42));
+
+    table->leave(42);
+    EXPECT_FALSE(table->contains(42));
+}
+
+TEST_F(InProgressTableTest, FullBucketRejectsNewPositions) {
+    // Keys differing only above the index bits share a bucket.
+    for (uint64_t i = 1; i <= IN_PROGRESS_WAYS; ++i) {
+        ASSERT_TRUE(table->enter(i * IN_PROGRESS_BUCKETS + 5));
+    }
+    const uint64_t overflow = (IN_PROGRESS_WAYS + 1) * IN_PROGRESS_BUCKETS + 5;
+
+    EXPECT_FALSE(table->enter(overflow));
+    EXPECT_FALSE(table->contains(overflow));
+    EXPECT_TRUE(table->enter(6)); // Other buckets are unaffected.
+}
+
+TEST_F(InProgressTableTest, EmptyKeyIsNeverInProgress) {
+    EXPECT_FALSE(table->enter(0));
+    EXPECT_FALSE(table->contains(0));
+}
@@ -0,0 +1,74 @@
+#include "board_state.hpp"
+#include "fen_formatter.hpp"
+#include "lazy_smp.hpp"
+#include "move.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using bitcrusher::BoardState;
+using bitcrusher::INITIAL_POSITION_FEN;
+using bitcrusher::Move;
+using bitcrusher::moveFromUci;
+using bitcrusher::parseFEN;
+using bitcrusher::pickVotedResult;
+using bitcrusher::skipsIteration;
+using bitcrusher::ThreadResult;
+
+class LazySmpTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        parseFEN(INITIAL_POSITION_FEN, board);
+        e2e4 = moveFromUci("e2e4", board);
+        d2d4 = moveFromUci("d2d4", board);
+    }
+
+    BoardState board;
+    Move       e2e4;
+    Move       d2d4;
+};
+
+TEST_F(LazySmpTest, MainThreadSearchesEveryDepth) {
+    for (int depth = 1; depth <= 64; ++depth) {
+        EXPECT_FALSE(skipsIteration(0, depth));
+    }
+}
+
+TEST_F(LazySmpTest, HelpersSkipDifferentDepths) {
+    // The first two helpers alternate, so one of them searches each depth.
+    for (int depth = 1; depth <= 64; ++depth) {
+        EXPECT_NE(skipsIteration(1, depth), skipsIteration(2, depth));
+    }
+}
+
+TEST_F(LazySmpTest, EveryHelperSearchesSomeDepths) {
+    for (int thread = 1; thread <= 64; ++thread) {
+        int searched = 0;
+        for (int depth = 1; depth <= 16; ++depth) {
+            searched += skipsIteration(thread, depth) ? 0 : 1;
+        }
+        EXPECT_GE(searched, 6);
+    }
+}
+
+TEST_F(LazySmpTest, MainThreadWinsTies) {
+    const std::vector<ThreadResult> results = {{e2e4, 10, 30, {}}, {d2d4, 10, 30, {}}};
+    EXPECT_EQ(pickVotedResult(results), 0);
+}
+
+TEST_F(LazySmpTest, DeeperAndBetterScoredThreadsOutvoteTheMainThread) {
+    const std::vector<ThreadResult> results = {
+        {e2e4, 10, 20, {}}, {d2d4, 12, 20, {}}, {d2d4, 11, 60, {}}};
+    EXPECT_NE(pickVotedResult(results), 0);
+    EXPECT_EQ(results[pickVotedResult(results)].best_move, d2d4);
+}
+
+TEST_F(LazySmpTest, ThreadsAgreeingOnAMoveAddUpTheirVotes) {
+    const std::vector<ThreadResult> results = {
+        {e2e4, 12, 40, {}}, {d2d4, 10, 40, {}}, {d2d4, 10, 40, {}}};
+    EXPECT_EQ(results[pickVotedResult(results)].best_move, d2d4);
+}
+
+TEST_F(LazySmpTest, ThreadsWithoutACompletedIterationDoNotVote) {
+    const std::vector<ThreadResult> results = {{e2e4, 0, 0, {}}, {d2d4, 5, -50, {}}};
+    EXPECT_EQ(pickVotedResult(results), 1);
+}
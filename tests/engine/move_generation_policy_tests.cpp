@@ -0,0 +1,67 @@
+#include "board_state.hpp"
+#include "fen_formatter.hpp"
+#include "legal_move_generators/legal_moves_generator.hpp"
+#include "move.hpp"
+#include "move_sink.hpp"
+#include "restriction_context.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+
+using bitcrusher::BoardState;
+using bitcrusher::Color;
+using bitcrusher::MoveGenerationPolicy;
+using bitcrusher::RestrictionContext;
+
+using UciMoves = std::unordered_set<std::string>;
+
+namespace {
+
+template <MoveGenerationPolicy MoveGenerationP> UciMoves generate(const std::string& fen) {
+    BoardState               board;
+    RestrictionContext       restriction_context;
+    bitcrusher::FastMoveSink sink;
+    bitcrusher::parseFEN(fen, board);
+    if (board.isWhiteMove()) {
+        bitcrusher::generateLegalMoves<Color::WHITE, MoveGenerationP>(board, sink,
+                                                                      restriction_context);
+    } else {
+        bitcrusher::generateLegalMoves<Color::BLACK, MoveGenerationP>(board, sink,
+                                                                      restriction_context);
+    }
+    UciMoves moves;
+    for (int i = 0; i < sink.count[0]; ++i) {
+        moves.insert(bitcrusher::toUci(sink.moves[0][i]));
+    }
+    return moves;
+}
+
+} // namespace
+
+class MoveGenerationPolicyTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(MoveGenerationPolicyTest, CapturesAndQuietsTogetherAreTheFullMoveList) {
+    const UciMoves full     = generate<MoveGenerationPolicy::COMPETITIVE_FULL>(GetParam());
+    const UciMoves captures = generate<MoveGenerationPolicy::COMPETITIVE_CAPTURES_ONLY>(GetParam());
+    const UciMoves quiets   = generate<MoveGenerationPolicy::COMPETITIVE_QUIETS_ONLY>(GetParam());
+
+    for (const std::string& move : captures) {
+        EXPECT_FALSE(quiets.contains(move)) << move;
+    }
+    UciMoves combined = captures;
+    combined.insert(quiets.begin(), quiets.end());
+    EXPECT_EQ(combined, full);
+}
+
+// Positions with castling, en passant, promotions and checks.
+INSTANTIATE_TEST_SUITE_P(
+    MoveGenerationPolicyTests,
+    MoveGenerationPolicyTest,
+    ::testing::Values(
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+        "4k3/8/8/8/8/8/4q3/4K3 w - - 0 1"));
@@ -0,0 +1,47 @@
+#include "node_counters.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using bitcrusher::NodeCounters;
+
+TEST(NodeCountersTest, TotalAddsUpEveryThread) {
+    NodeCounters counters{3};
+    counters.increment(0);
+    counters.increment(2);
+    counters.increment(2);
+
+    EXPECT_EQ(counters.threadNodes(0), 1);
+    EXPECT_EQ(counters.threadNodes(1), 0);
+    EXPECT_EQ(counters.threadNodes(2), 2);
+    EXPECT_EQ(counters.total(), 3);
+}
+
+TEST(NodeCountersTest, ResetAndResizeStartFromZero) {
+    NodeCounters counters{2};
+    counters.increment(1);
+    counters.reset();
+    EXPECT_EQ(counters.total(), 0);
+
+    counters.increment(0);
+    counters.resize(4);
+    EXPECT_EQ(counters.threadCount(), 4);
+    EXPECT_EQ(counters.total(), 0);
+}
+
+TEST(NodeCountersTest, CountersOfConcurrentThreadsAreExact) {
+    constexpr int      THREADS = 4;
+    constexpr uint64_t NODES   = 100'000;
+    NodeCounters       counters{THREADS};
+    {
+        std::vector<std::jthread> threads;
+        for (int thread = 0; thread < THREADS; ++thread) {
+            threads.emplace_back([&counters, thread]() {
+                for (uint64_t i = 0; i < NODES; ++i) {
+                    counters.increment(thread);
+                }
+            });
+        }
+    }
+    EXPECT_EQ(counters.total(), THREADS * NODES);
+}
@@ -0,0 +1,68 @@
+#include "board_state.hpp"
+#include "fen_formatter.hpp"
+#include "move.hpp"
+#include "principal_variation.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+
+using bitcrusher::BoardState;
+using bitcrusher::INITIAL_POSITION_FEN;
+using bitcrusher::Move;
+using bitcrusher::moveFromUci;
+using bitcrusher::parseFEN;
+using bitcrusher::PrincipalVariationTable;
+
+class PrincipalVariationTableTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        parseFEN(INITIAL_POSITION_FEN, board);
+        e2e4 = moveFromUci("e2e4", board);
+        d2d4 = moveFromUci("d2d4", board);
+        g1f3 = moveFromUci("g1f3", board);
+    }
+
+    BoardState                               board;
+    Move                                     e2e4;
+    Move                                     d2d4;
+    Move                                     g1f3;
+    std::unique_ptr<PrincipalVariationTable> pv = std::make_unique<PrincipalVariationTable>();
+};
+
+TEST_F(PrincipalVariationTableTest, UpdateCopiesTheChildLine) {
+    // Simulates a search of depth 3 where every node raised alpha.
+    pv->clear(0);
+    pv->clear(1);
+    pv->clear(2);
+    pv->clear(3);
+    pv->update(2, g1f3);
+    pv->update(1, d2d4);
+    pv->update(0, e2e4);
+
+    ASSERT_EQ(pv->line().size(), 3);
+    EXPECT_EQ(pv->line()[0], e2e4);
+    EXPECT_EQ(pv->line()[1], d2d4);
+    EXPECT_EQ(pv->line()[2], g1f3);
+}
+
+TEST_F(PrincipalVariationTableTest, BetterMoveReplacesTheWholeLine) {
+    pv->clear(0);
+    pv->clear(1);
+    pv->clear(2);
+    pv->update(1, d2d4);
+    pv->update(0, e2e4);
+    // The next root move's child cut off without raising alpha.
+    pv->clear(1);
+    pv->update(0, g1f3);
+
+    ASSERT_EQ(pv->line().size(), 1);
+    EXPECT_EQ(pv->line()[0], g1f3);
+}
+
+TEST_F(PrincipalVariationTableTest, ClearedRowIsEmpty) {
+    pv->clear(0);
+    pv->clear(1);
+    pv->update(0, e2e4);
+    pv->clear(0);
+
+    EXPECT_TRUE(pv->line().empty());
+}
@@ -0,0 +1,113 @@
+#include "bitboard_enums.hpp"
+#include "move.hpp"
+#include "move_ordering/quiet_move_history.hpp"
+#include "move_ordering/score_moves.hpp"
+#include "search_config.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using bitcrusher::Color;
+using bitcrusher::Move;
+using bitcrusher::PieceType;
+using bitcrusher::Square;
+using bitcrusher::heuristics::ButterflyHistory;
+using bitcrusher::heuristics::CounterMoveTable;
+using bitcrusher::heuristics::HISTORY_MAX;
+using bitcrusher::heuristics::KILLER_SLOTS;
+using bitcrusher::heuristics::KillerMoves;
+using bitcrusher::heuristics::QuietMoveHistory;
+
+TEST(QuietMoveHistoryTest, KillersKeepTheTwoMostRecentCutoffMovesPerPly) {
+    KillerMoves killers;
+    const Move  first  = Move::createQuietMove(Square::G1, Square::F3, PieceType::KNIGHT);
+    const Move  second = Move::createQuietMove(Square::B1, Square::C3, PieceType::KNIGHT);
+    const Move  third  = Move::createQuietMove(Square::F1, Square::C4, PieceType::BISHOP);
+
+    killers.store(3, first);
+    killers.store(3, second);
+    killers.store(3, second); // Storing the newest killer again keeps the older one.
+    EXPECT_EQ(killers.slotOf(3, second), 0);
+    EXPECT_EQ(killers.slotOf(3, first), 1);
+    EXPECT_EQ(killers.slotOf(4, second), KILLER_SLOTS);
+
+    killers.store(3, third);
+    EXPECT_EQ(killers.slotOf(3, third), 0);
+    EXPECT_EQ(killers.slotOf(3, second), 1);
+    EXPECT_EQ(killers.slotOf(3, first), KILLER_SLOTS);
+}
+
+TEST(QuietMoveHistoryTest, HistoryGravityKeepsScoresWithinRange) {
+    ButterflyHistory history;
+    const Move       move = Move::createQuietMove(Square::E2, Square::E4, PieceType::PAWN);
+
+    history.update<Color::WHITE>(move, 100);
+    EXPECT_EQ(history.get<Color::WHITE>(move), 100);
+    EXPECT_EQ(history.get<Color::BLACK>(move), 0);
+
+    for (int i = 0; i < 1'000; ++i) {
+        history.update<Color::WHITE>(move, 1'200);
+    }
+    EXPECT_LE(history.get<Color::WHITE>(move), HISTORY_MAX);
+    EXPECT_GT(history.get<Color::WHITE>(move), HISTORY_MAX - 100);
+
+    for (int i = 0; i < 1'000; ++i) {
+        history.update<Color::WHITE>(move, -1'200);
+    }
+    EXPECT_GE(history.get<Color::WHITE>(move), -HISTORY_MAX);
+}
+
+TEST(QuietMoveHistoryTest, CountermoveIsStoredForThePreviousMove) {
+    CounterMoveTable countermoves;
+    const Move       previous = Move::createQuietMove(Square::G8, Square::F6, PieceType::KNIGHT);
+    const Move       reply    = Move::createQuietMove(Square::E4, Square::E5, PieceType::PAWN);
+
+    EXPECT_EQ(countermoves.get<Color::WHITE>(previous), Move::none());
+    countermoves.store<Color::WHITE>(previous, reply);
+    EXPECT_EQ(countermoves.get<Color::WHITE>(previous), reply);
+    EXPECT_EQ(countermoves.get<Color::BLACK>(previous), Move::none());
+
+    // Nothing is recorded after a null move.
+    countermoves.store<Color::WHITE>(Move::none(), reply);
+    EXPECT_EQ(countermoves.get<Color::WHITE>(Move::none()), Move::none());
+}
+
+TEST(QuietMoveHistoryTest, CutoffPenalisesQuietMovesSearchedBeforeIt) {
+    QuietMoveHistory  history;
+    const Move        previous = Move::createQuietMove(Square::E7, Square::E5, PieceType::PAWN);
+    const Move        cutoff   = Move::createQuietMove(Square::G1, Square::F3, PieceType::KNIGHT);
+    std::vector<Move> searched{Move::createQuietMove(Square::A2, Square::A3, PieceType::PAWN)};
+
+    bitcrusher::heuristics::updateQuietMoveHistory<bitcrusher::DEFAULT_CONFIG, Color::WHITE>(
+        history, 2, 4, cutoff, previous, searched);
+
+    EXPECT_EQ(history.killers.slotOf(2, cutoff), 0);
+    EXPECT_GT(history.butterfly.get<Color::WHITE>(cutoff), 0);
+    EXPECT_LT(history.butterfly.get<Color::WHITE>(searched[0]), 0);
+    EXPECT_EQ(history.countermoves.get<Color::WHITE>(previous), cutoff);
+}
+
+TEST(QuietMoveHistoryTest, QuietMovesAreOrderedByKillersThenCountermoveThenHistory) {
+    QuietMoveHistory history;
+
+    const Move previous     = Move::createQuietMove(Square::E7, Square::E5, PieceType::PAWN);
+    const Move killer       = Move::createQuietMove(Square::G1, Square::F3, PieceType::KNIGHT);
+    const Move old_killer   = Move::createQuietMove(Square::B1, Square::C3, PieceType::KNIGHT);
+    const Move countermove  = Move::createQuietMove(Square::F1, Square::C4, PieceType::BISHOP);
+    const Move best_history = Move::createQuietMove(Square::D2, Square::D4, PieceType::PAWN);
+    const Move other        = Move::createQuietMove(Square::A2, Square::A3, PieceType::PAWN);
+    history.killers.store(2, old_killer);
+    history.killers.store(2, killer);
+    history.countermoves.store<Color::WHITE>(previous, countermove);
+    for (int i = 0; i < 1'000; ++i) {
+        history.butterfly.update<Color::WHITE>(best_history, 1'200);
+    }
+
+    const auto score = [&](const Move& move) {
+        return bitcrusher::heuristics::scoreQuiet<bitcrusher::DEFAULT_CONFIG, Color::WHITE>(
+            move, history, 2, history.countermoves.get<Color::WHITE>(previous));
+    };
+    EXPECT_GT(score(killer), score(old_killer));
+    EXPECT_GT(score(old_killer), score(countermove));
+    EXPECT_GT(score(countermove), score(best_history));
+    EXPECT_GT(score(best_history), score(other));
+}
@@ -1,10 +1,16 @@
 #include "move_sink.hpp"
 #include "search.hpp"
 #include "search_manager.hpp"
+#include <array>
+#include <cstdlib>
 #include <gtest/gtest.h>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 using bitcrusher::Move;
 using bitcrusher::SearchManager;
@@ -122,6 +128,210 @@ TEST(searchTests, SearchMovesProduceConsistentEvaluationAsUnrestricted) {
     EXPECT_EQ(unrestricted_search_eval, restricted_search_eval);
 }
 
+TEST(searchTests, TranspositionTableIsKeptBetweenSearches) {
+    SearchManager search_manager{};
+    search_manager.setPos("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+    bitcrusher::SearchParameters params;
+    params.max_ply               = 4;
+    params.use_quiescence_search = false;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+    const uint64_t first_search_nodes = search_manager.getNodeCount();
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+    const uint64_t second_search_nodes = search_manager.getNodeCount();
+
+    EXPECT_LT(second_search_nodes, first_search_nodes);
+
+    // A new game starts from an empty table again.
+    search_manager.newGame();
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_EQ(search_manager.getNodeCount(), first_search_nodes);
+}
+
+TEST(searchTests, QuiescenceSearchReusesTranspositionTable) {
+    bitcrusher::ZobristKeys::init(12345);
+    auto ctx = std::make_unique<bitcrusher::SharedSearchContext>();
+
+    bitcrusher::BoardState board;
+    // Several exchanges available on e5 and d5.
+    bitcrusher::parseFEN("r1bqkb1r/ppp2ppp/2n2n2/3pp3/3PP3/2N2N2/PPP2PPP/R1BQKB1R w KQkq - 0 5",
+                         board);
+    bitcrusher::MoveProcessor      move_processor;
+    bitcrusher::RestrictionContext restriction_context;
+    bitcrusher::FastMoveSink       sink;
+    std::stop_token                st;
+
+    auto run = [&]() {
+        ctx->nodes_searched.reset();
+        return bitcrusher::quiescenceSearch<bitcrusher::Color::WHITE>(
+            *ctx, board, move_processor, restriction_context, -bitcrusher::CHECKMATE_BASE,
+            bitcrusher::CHECKMATE_BASE, st, sink, 0);
+    };
+    const int      first_score  = run();
+    const uint64_t first_nodes  = ctx->nodes_searched.total();
+    const int      second_score = run();
+
+    EXPECT_GT(first_nodes, 1);
+    EXPECT_EQ(second_score, first_score);
+    EXPECT_EQ(ctx->nodes_searched.total(), 1); // Exact entry for the root position.
+}
+
+namespace {
+
+// Qxh7+ (h6h7) is a queen sacrifice that only pays off several plies later.
+constexpr std::string_view SACRIFICE_FEN =
+    "r1bq2rk/pp3pbp/2p1p1pQ/7P/3P4/2PB1N2/PP3PP1/R3K2R w KQ - 0 1";
+
+struct DepthSearchResult {
+    uint64_t    nodes{0};
+    std::string best_move;
+    int         score{0}; // Of the last iteration.
+};
+
+// Iterative deepening of the side to move with a fresh table.
+template <bitcrusher::SearchConfig Config>
+DepthSearchResult searchToDepth(std::string_view fen, int max_depth) {
+    auto ctx        = std::make_unique<bitcrusher::SharedSearchContext>();
+    auto thread_ctx = std::make_unique<bitcrusher::ThreadSearchContext>();
+    bitcrusher::BoardState board;
+    bitcrusher::parseFEN(fen, board);
+    bitcrusher::MoveProcessor          move_processor;
+    bitcrusher::RestrictionContext     restriction_context;
+    bitcrusher::FastMoveSink           sink;
+    const bitcrusher::SearchParameters params;
+    std::stop_token                    st;
+    int                                score = 0;
+    for (int depth = 1; depth <= max_depth; ++depth) {
+        ctx->tt.newSearch();
+        if (board.isWhiteMove()) {
+            score = bitcrusher::search<bitcrusher::Color::WHITE, Config, true>(
+                *ctx, *thread_ctx, board, move_processor, params, restriction_context, depth,
+                -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+        } else {
+            score = bitcrusher::search<bitcrusher::Color::BLACK, Config, true>(
+                *ctx, *thread_ctx, board, move_processor, params, restriction_context, depth,
+                -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+        }
+    }
+    return {ctx->nodes_searched.total(), bitcrusher::toUci(thread_ctx->root_best_move), score};
+}
+
+} // namespace
+
+TEST(searchTests, NullMovePruningReducesSearchedNodes) {
+    bitcrusher::ZobristKeys::init(12345);
+    constexpr std::string_view FEN =
+        "r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq - 4 4";
+    constexpr bitcrusher::SearchConfig NO_NULL_MOVE_CONFIG = [] {
+        bitcrusher::SearchConfig config  = bitcrusher::DEFAULT_CONFIG;
+        config.null_move_pruning.enabled = false;
+        return config;
+    }();
+
+    const uint64_t with_null_move    = searchToDepth<bitcrusher::DEFAULT_CONFIG>(FEN, 5).nodes;
+    const uint64_t without_null_move = searchToDepth<NO_NULL_MOVE_CONFIG>(FEN, 5).nodes;
+    EXPECT_LT(with_null_move, without_null_move);
+
+    EXPECT_EQ(searchToDepth<bitcrusher::DEFAULT_CONFIG>(SACRIFICE_FEN, 5).best_move, "h6h7");
+    EXPECT_EQ(searchToDepth<NO_NULL_MOVE_CONFIG>(SACRIFICE_FEN, 5).best_move, "h6h7");
+}
+
+TEST(searchTests, LateMoveReductionsAndPrincipalVariationSearchReduceSearchedNodes) {
+    bitcrusher::ZobristKeys::init(12345);
+    constexpr std::string_view FEN =
+        "r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq - 4 4";
+    constexpr bitcrusher::SearchConfig NO_LMR_CONFIG = [] {
+        bitcrusher::SearchConfig config     = bitcrusher::DEFAULT_CONFIG;
+        config.late_move_reductions.enabled = false;
+        return config;
+    }();
+    constexpr bitcrusher::SearchConfig FULL_WINDOW_CONFIG = [] {
+        bitcrusher::SearchConfig config           = bitcrusher::DEFAULT_CONFIG;
+        config.principal_variation_search.enabled = false;
+        return config;
+    }();
+
+    const uint64_t reduced     = searchToDepth<bitcrusher::DEFAULT_CONFIG>(FEN, 6).nodes;
+    const uint64_t no_lmr      = searchToDepth<NO_LMR_CONFIG>(FEN, 6).nodes;
+    const uint64_t full_window = searchToDepth<FULL_WINDOW_CONFIG>(FEN, 6).nodes;
+    EXPECT_LT(reduced, no_lmr);
+    EXPECT_LT(reduced, full_window);
+
+    // Re-searches must restore what the reduced and zero window searches missed.
+    const DepthSearchResult reduced_result =
+        searchToDepth<bitcrusher::DEFAULT_CONFIG>(SACRIFICE_FEN, 5);
+    EXPECT_EQ(reduced_result.best_move, "h6h7");
+    EXPECT_EQ(searchToDepth<NO_LMR_CONFIG>(SACRIFICE_FEN, 5).best_move, reduced_result.best_move);
+    EXPECT_EQ(searchToDepth<FULL_WINDOW_CONFIG>(SACRIFICE_FEN, 5).best_move,
+              reduced_result.best_move);
+}
+
+// Each pruning turned off on its own searches more nodes than the default search.
+TEST(searchTests, FutilityAndDeltaPruningEachReduceSearchedNodes) {
+    bitcrusher::ZobristKeys::init(12345);
+    // Middlegame with several exchanges available.
+    constexpr std::string_view FEN =
+        "r1bqkb1r/ppp2ppp/2n2n2/3pp3/3PP3/2N2N2/PPP2PPP/R1BQKB1R w KQkq - 0 5";
+    constexpr bitcrusher::SearchConfig NO_DELTA_CONFIG = [] {
+        bitcrusher::SearchConfig config = bitcrusher::DEFAULT_CONFIG;
+        config.delta_pruning.enabled    = false;
+        return config;
+    }();
+    constexpr bitcrusher::SearchConfig NO_FUTILITY_CONFIG = [] {
+        bitcrusher::SearchConfig config = bitcrusher::DEFAULT_CONFIG;
+        config.futility_pruning.enabled = false;
+        return config;
+    }();
+    constexpr bitcrusher::SearchConfig NO_REVERSE_FUTILITY_CONFIG = [] {
+        bitcrusher::SearchConfig config         = bitcrusher::DEFAULT_CONFIG;
+        config.reverse_futility_pruning.enabled = false;
+        return config;
+    }();
+
+    const uint64_t pruned = searchToDepth<bitcrusher::DEFAULT_CONFIG>(FEN, 6).nodes;
+    EXPECT_LT(pruned, searchToDepth<NO_DELTA_CONFIG>(FEN, 6).nodes);
+    EXPECT_LT(pruned, searchToDepth<NO_FUTILITY_CONFIG>(FEN, 6).nodes);
+    EXPECT_LT(pruned, searchToDepth<NO_REVERSE_FUTILITY_CONFIG>(FEN, 6).nodes);
+}
+
+TEST(searchTests, FutilityPruningKeepsWinningMovesOfTheSideBehind) {
+    bitcrusher::ZobristKeys::init(12345);
+    // White is far behind in material in both, below any futility margin.
+    struct WinningMove {
+        std::string_view fen;
+        std::string_view move;
+    };
+    constexpr std::array<WinningMove, 2> POSITIONS = {{
+        {"8/3KP3/8/8/8/8/8/k6r w - - 0 1", "e7e8q"},     // A promotion the king defends.
+        {"6k1/5ppp/8/8/8/8/q4PPP/3R2K1 w - - 0 1", "d1d8"}, // A quiet back rank mate.
+    }};
+    for (const WinningMove& position : POSITIONS) {
+        EXPECT_EQ(searchToDepth<bitcrusher::DEFAULT_CONFIG>(position.fen, 5).best_move,
+                  position.move)
+            << position.fen;
+    }
+}
+
+TEST(searchTests, EveryIterationIsReportedWithItsDepthInPlies) {
+    SearchManager    search_manager{};
+    std::vector<int> reported_depths;
+    search_manager.setOnDepthCompleted(
+        [&reported_depths](int depth) { reported_depths.push_back(depth); });
+    search_manager.setPosToStartpos();
+    bitcrusher::SearchParameters params;
+    params.max_ply = 4;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_EQ(reported_depths, (std::vector<int>{1, 2, 3, 4}));
+}
+
 TEST(searchTests, MateIn1) {
     SearchManager search_manager{};
     std::string   best_move;
@@ -142,6 +352,209 @@ TEST(searchTests, MateIn1) {
     EXPECT_EQ(eval, "mate 1");
 }
 
+TEST(searchTests, QuietMateFoundInEarlierIterationIsKeptWhenTimeRunsOut) {
+    // The root generates every move before trying the first one. A quiet TT move must still be
+    // tried first, or the iteration cut short by the time limit reports another move.
+    SearchManager search_manager{};
+    std::string   best_move;
+    search_manager.setOnSearchFinished(
+        [&search_manager, &best_move]() { best_move = search_manager.bestMoveUci(); });
+    search_manager.setPos("2rr3k/pp3pp1/1nnqbN1p/3pN3/2pP4/2P3Q1/PPB4P/R4RK1 w - - 0 1");
+    bitcrusher::SearchParameters params;
+    params.move_time_ms = 300;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_EQ(best_move, "g3g6");
+}
+
+TEST(searchTests, InterruptedIterationFallsBackToThePreviousBestMove) {
+    // Stopped before its first root move returns, an iteration keeps the best move of the previous
+    // one, and a new search starts from the TT move. Neither is the first generated move.
+    bitcrusher::ZobristKeys::init(12345);
+    auto                   ctx        = std::make_unique<bitcrusher::SharedSearchContext>();
+    auto                   thread_ctx = std::make_unique<bitcrusher::ThreadSearchContext>();
+    bitcrusher::BoardState board;
+    bitcrusher::parseFEN("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61", board);
+    bitcrusher::MoveProcessor          move_processor;
+    bitcrusher::RestrictionContext     restriction_context;
+    bitcrusher::FastMoveSink           sink;
+    const bitcrusher::SearchParameters params;
+    std::stop_token                    st;
+
+    bitcrusher::search<bitcrusher::Color::WHITE, bitcrusher::DEFAULT_CONFIG, true>(
+        *ctx, *thread_ctx, board, move_processor, params, restriction_context, 1,
+        -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+    ASSERT_EQ(bitcrusher::toUci(thread_ctx->root_best_move), "c2c4");
+
+    // PauseAfterRootSort=true skips the stop check at the root, so the root generates its moves
+    // and records the fallback before the first move searched sees the stop.
+    std::stop_source stop;
+    stop.request_stop();
+    std::stop_token  stopped        = stop.get_token();
+    const auto       search_stopped = [&] {
+        return bitcrusher::search<bitcrusher::Color::WHITE, bitcrusher::DEFAULT_CONFIG, true, true>(
+            *ctx, *thread_ctx, board, move_processor, params, restriction_context, 2,
+            -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, stopped, sink);
+    };
+    EXPECT_EQ(std::abs(search_stopped()), bitcrusher::SEARCH_INTERRUPTED);
+    EXPECT_EQ(bitcrusher::toUci(thread_ctx->root_best_move), "c2c4");
+
+    thread_ctx = std::make_unique<bitcrusher::ThreadSearchContext>();
+    EXPECT_EQ(std::abs(search_stopped()), bitcrusher::SEARCH_INTERRUPTED);
+    EXPECT_EQ(bitcrusher::toUci(thread_ctx->root_best_move), "c2c4");
+}
+
+TEST(searchTests, InterruptedAspirationResearchKeepsTheRestoredBestMove) {
+    // After a fail low the search manager puts the previous iteration's move back into
+    // root_best_move. A re-search stopped before any root move completes must report it, even
+    // when the TT move is another one.
+    bitcrusher::ZobristKeys::init(12345);
+    auto                   ctx        = std::make_unique<bitcrusher::SharedSearchContext>();
+    auto                   thread_ctx = std::make_unique<bitcrusher::ThreadSearchContext>();
+    bitcrusher::BoardState board;
+    bitcrusher::parseFEN("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61", board);
+    bitcrusher::MoveProcessor          move_processor;
+    bitcrusher::RestrictionContext     restriction_context;
+    bitcrusher::FastMoveSink           sink;
+    const bitcrusher::SearchParameters params;
+    std::stop_token                    st;
+
+    bitcrusher::search<bitcrusher::Color::WHITE, bitcrusher::DEFAULT_CONFIG, true>(
+        *ctx, *thread_ctx, board, move_processor, params, restriction_context, 2,
+        -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+    ASSERT_EQ(bitcrusher::toUci(thread_ctx->root_best_move), "c2c4");
+
+    thread_ctx->root_best_move = bitcrusher::moveFromUci("c2c3", board);
+    std::stop_source stop;
+    stop.request_stop();
+    std::stop_token stopped = stop.get_token();
+    const int       score =
+        bitcrusher::search<bitcrusher::Color::WHITE, bitcrusher::DEFAULT_CONFIG, true, true>(
+            *ctx, *thread_ctx, board, move_processor, params, restriction_context, 3,
+            -bitcrusher::CHECKMATE_BASE, -bitcrusher::CHECKMATE_THRESHOLD, stopped, sink);
+
+    EXPECT_EQ(std::abs(score), bitcrusher::SEARCH_INTERRUPTED);
+    EXPECT_EQ(bitcrusher::toUci(thread_ctx->root_best_move), "c2c3");
+}
+
+TEST(searchTests, SeveralThreadsAgreeOnMateIn1) {
+    SearchManager search_manager{};
+    search_manager.setMaxCores(4);
+    std::string best_move;
+    std::string eval;
+    search_manager.setOnSearchFinished([&search_manager, &best_move, &eval]() {
+        best_move = search_manager.bestMoveUci();
+        eval      = search_manager.getScore();
+    });
+    search_manager.setPos("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61");
+    bitcrusher::SearchParameters params;
+    params.max_ply = 4;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_EQ(best_move, "c2c4");
+    EXPECT_EQ(eval, "mate 1");
+}
+
+TEST(searchTests, SplitPointSearchFindsMateIn1) {
+    SearchManager search_manager{};
+    search_manager.setMaxCores(4);
+    search_manager.setParallelSearchMode(bitcrusher::ParallelSearchMode::YBWC);
+    std::string best_move;
+    std::string eval;
+    search_manager.setOnSearchFinished([&search_manager, &best_move, &eval]() {
+        best_move = search_manager.bestMoveUci();
+        eval      = search_manager.getScore();
+    });
+    search_manager.setPos("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61");
+    bitcrusher::SearchParameters params;
+    params.max_ply = 6;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_EQ(best_move, "c2c4");
+    EXPECT_EQ(eval, "mate 1");
+}
+
+TEST(searchTests, SplitPointSearchOnlyUsesSearchMoves) {
+    SearchManager search_manager{};
+    search_manager.setMaxCores(4);
+    search_manager.setParallelSearchMode(bitcrusher::ParallelSearchMode::YBWC);
+    std::string best_move;
+    search_manager.setOnSearchFinished(
+        [&search_manager, &best_move]() { best_move = search_manager.bestMoveUci(); });
+    search_manager.setPosToStartpos();
+    bitcrusher::SearchParameters params;
+    params.addSearchMove("a2a3");
+    params.addSearchMove("h2h3");
+    params.max_ply = 6;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_TRUE(best_move == "a2a3" || best_move == "h2h3");
+}
+
+TEST(searchTests, SplitPointSearchStillSearchesDeferredMoves) {
+    // Re1xe8 is mate. The root orders it right after h2h3, the TT move, which search moves leave
+    // out, so Rxe8 is searched exclusively. Its position is marked as searched by another thread
+    // (ABDADA), so it is deferred. A helper is already idle, so the root may split after the
+    // next move; Rxe8 must still be searched in the deferred pass.
+    bitcrusher::ZobristKeys::init(12345);
+    auto ctx        = std::make_unique<bitcrusher::SharedSearchContext>();
+    auto thread_ctx = std::make_unique<bitcrusher::ThreadSearchContext>();
+    ctx->nodes_searched.resize(2);
+    bitcrusher::BoardState board;
+    bitcrusher::parseFEN("4r1k1/5ppp/8/8/8/8/5PPP/4R1K1 w - - 0 1", board);
+    bitcrusher::MoveProcessor      move_processor;
+    bitcrusher::RestrictionContext restriction_context;
+    bitcrusher::FastMoveSink       sink;
+    std::stop_token                st;
+
+    ctx->tt.store(board.getZobristHash(), 0,
+                  bitcrusher::packMove(bitcrusher::moveFromUci("h2h3", board)), 1,
+                  bitcrusher::TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    bitcrusher::BoardState    after_mate = board;
+    bitcrusher::MoveProcessor mate_processor;
+    mate_processor.applyMove(after_mate, bitcrusher::moveFromUci("e1e8", after_mate));
+    ctx->tt.store(after_mate.getZobristHash(), 0, bitcrusher::PACKED_MOVE_NONE, 1,
+                  bitcrusher::TranspositionTableEvaluationType::EXACT_VALUE, 1);
+    ASSERT_TRUE(ctx->in_progress.enter(after_mate.getZobristHash()));
+
+    bitcrusher::SearchParameters params;
+    for (const std::string_view move : {"e1e8", "e1e7", "e1e6", "e1e5", "e1e4", "e1e3", "e1e2",
+                                        "e1d1", "e1c1", "e1b1", "e1a1", "e1f1", "g1f1", "f2f3",
+                                        "f2f4", "g2g3", "g2g4", "h2h4"}) {
+        params.addSearchMove(std::string(move));
+    }
+
+    std::stop_source helper_stop;
+    std::jthread     helper([&ctx, token = helper_stop.get_token()] {
+        bitcrusher::search_thread_index = 1;
+        bitcrusher::SplitWorker worker;
+        while (bitcrusher::SplitPoint* split = ctx->split_points.waitAndJoin(token)) {
+            split->join(*split, worker);
+            split->leave();
+        }
+    });
+    while (! ctx->split_points.hasIdleHelper()) {
+        std::this_thread::yield();
+    }
+
+    const int score =
+        bitcrusher::search<bitcrusher::Color::WHITE, bitcrusher::DEFAULT_CONFIG, true>(
+            *ctx, *thread_ctx, board, move_processor, params, restriction_context, 4,
+            -bitcrusher::CHECKMATE_BASE, bitcrusher::CHECKMATE_BASE, st, sink);
+    helper_stop.request_stop();
+
+    EXPECT_EQ(bitcrusher::toUci(thread_ctx->root_best_move), "e1e8");
+    EXPECT_GE(score, bitcrusher::CHECKMATE_THRESHOLD);
+}
+
 TEST(searchTests, GettingMatedIn1) {
     SearchManager search_manager{};
     std::string   best_move;
@@ -162,6 +575,28 @@ TEST(searchTests, GettingMatedIn1) {
     EXPECT_EQ(eval, "mate -1");
 }
 
+TEST(searchTests, CheckExtensionFindsMateBeyondTheNominalDepth) {
+    // Qe8+ Rxe8 Rxe8# takes three plies. Black is in check after the first one, which extends
+    // the two ply search far enough to see the mate without quiescence search.
+    SearchManager search_manager{};
+    std::string   best_move;
+    std::string   eval;
+    search_manager.setOnSearchFinished([&search_manager, &best_move, &eval]() {
+        best_move = search_manager.bestMoveUci();
+        eval      = search_manager.getScore();
+    });
+    search_manager.setPos("r5k1/5ppp/8/8/8/8/4QPPP/4R1K1 w - - 0 1");
+    bitcrusher::SearchParameters params;
+    params.max_ply               = 2;
+    params.use_quiescence_search = false;
+
+    search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+    search_manager.waitUntilSearchFinished();
+
+    EXPECT_EQ(best_move, "e2e8");
+    EXPECT_EQ(eval, "mate 2");
+}
+
 TEST(searchTests, PonderingSuspendsSearchUntilPonderHit) {
     SearchManager     search_manager{};
     std::string       best_move;
@@ -211,8 +646,9 @@ TEST(searchTests, SearchOutputsLegalFallbackMoveWhenAbortedInstantly) {
 
     std::string previous_best_move = best_move;
 
-    // 2. Set a completely different position where the previous move is ILLEGAL.
-    search_manager.setPos("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    // 2. Set a completely different position where the previous move is ILLEGAL. In the same
+    // position the fallback is the TT move, which may well be the previous best move.
+    search_manager.setPos("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1");
     bitcrusher::SearchParameters instant_abort_params;
     instant_abort_params.use_quiescence_search = false;
 
@@ -229,11 +665,11 @@ TEST(searchTests, SearchOutputsLegalFallbackMoveWhenAbortedInstantly) {
 
     // Verify it emits a legal move for the current position instead of a stale one.
     bool is_legal =
-        (best_move == "e2e4" || best_move == "d2d4" || best_move == "e2e3" || best_move == "d2d3" ||
-         best_move == "g1f3" || best_move == "b1c3" || best_move == "g1h3" || best_move == "b1a3" ||
-         best_move == "a2a3" || best_move == "a2a4" || best_move == "b2b3" || best_move == "b2b4" ||
-         best_move == "c2c3" || best_move == "c2c4" || best_move == "f2f3" || best_move == "f2f4" ||
-         best_move == "g2g3" || best_move == "g2g4" || best_move == "h2h3" || best_move == "h2h4");
+        (best_move == "e7e5" || best_move == "d7d5" || best_move == "e7e6" || best_move == "d7d6" ||
+         best_move == "g8f6" || best_move == "b8c6" || best_move == "g8h6" || best_move == "b8a6" ||
+         best_move == "a7a6" || best_move == "a7a5" || best_move == "b7b6" || best_move == "b7b5" ||
+         best_move == "c7c6" || best_move == "c7c5" || best_move == "f7f6" || best_move == "f7f5" ||
+         best_move == "g7g6" || best_move == "g7g5" || best_move == "h7h6" || best_move == "h7h5");
     EXPECT_TRUE(is_legal);
 }
 
@@ -246,13 +682,13 @@ TEST(searchTests, PrincipalVariationShouldBeCycleFree) {
     std::string   pv;
 
     search_manager.setOnSearchFinished(
-        [&search_manager, &pv]() { pv = search_manager.getPrincipalVariation(80); });
+        [&search_manager, &pv]() { pv = search_manager.getPrincipalVariation(); });
 
     const std::string_view fen = "1k6/8/2RK4/8/8/8/8/8 w - - 19 92";
     search_manager.setPos(fen);
 
     bitcrusher::SearchParameters params;
-    params.max_ply               = 80; // depth 40; bug appeared at depth 21+
+    params.max_ply               = 80; // Bug appeared at depth 42+
     params.use_quiescence_search = false;
 
     search_manager.startSearch<bitcrusher::FastMoveSink>(params);
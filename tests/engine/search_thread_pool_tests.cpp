@@ -0,0 +1,91 @@
+#include "search_manager.hpp"
+#include "search_thread_pool.hpp"
+#include <atomic>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using bitcrusher::SearchManager;
+using bitcrusher::SearchThreadPool;
+
+TEST(SearchThreadPoolTest, RunsEverySubmittedTask) {
+    SearchThreadPool                pool{2};
+    std::atomic<int>                runs{0};
+    std::vector<std::promise<void>> done(5);
+    for (auto& promise : done) {
+        pool.submit([&runs, &promise]() {
+            ++runs;
+            promise.set_value();
+        });
+    }
+    for (auto& promise : done) {
+        promise.get_future().wait();
+    }
+    EXPECT_EQ(runs.load(), 5);
+}
+
+TEST(SearchThreadPoolTest, GrowsWhenEveryThreadIsBusy) {
+    SearchThreadPool         pool{1};
+    std::promise<void>       release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void>       first_started;
+    std::promise<void>       second_started;
+    pool.submit([&first_started, released]() {
+        first_started.set_value();
+        released.wait();
+    });
+    pool.submit([&second_started, released]() {
+        second_started.set_value();
+        released.wait();
+    });
+    first_started.get_future().wait();
+    second_started.get_future().wait();
+    EXPECT_EQ(pool.size(), 2);
+    release.set_value();
+}
+
+TEST(SearchThreadPoolTest, ShrinksWithoutWaitingForBusyThreads) {
+    SearchThreadPool         pool{3};
+    std::promise<void>       release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void>       started;
+    pool.submit([&started, released]() {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    // Returns while a task is still running; only the idle threads leave the pool at once.
+    pool.resize(1);
+    EXPECT_EQ(pool.size(), 1);
+    release.set_value();
+
+    pool.resize(4);
+    EXPECT_EQ(pool.size(), 4);
+}
+
+TEST(SearchThreadPoolTest, ManagersShareOnePool) {
+    auto pool = std::make_shared<SearchThreadPool>();
+    for (int search = 0; search < 2; ++search) {
+        SearchManager first{pool};
+        SearchManager second{pool};
+        first.setMaxCores(2);
+        second.setMaxCores(2);
+        first.setPos("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61");
+        second.setPos("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61");
+        bitcrusher::SearchParameters params;
+        params.max_ply = 3;
+
+        first.startSearch<bitcrusher::FastMoveSink>(params);
+        second.startSearch<bitcrusher::FastMoveSink>(params);
+        first.waitUntilSearchFinished();
+        second.waitUntilSearchFinished();
+
+        EXPECT_EQ(first.bestMoveUci(), "c2c4");
+        EXPECT_EQ(second.bestMoveUci(), "c2c4");
+        // The threads outlive both managers.
+        EXPECT_GE(pool->size(), 2);
+    }
+}
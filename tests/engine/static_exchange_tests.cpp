@@ -0,0 +1,64 @@
+#include "bitboard_enums.hpp"
+#include "board_state.hpp"
+#include "fen_formatter.hpp"
+#include "move.hpp"
+#include "static_exchange.hpp"
+#include <gtest/gtest.h>
+#include <string_view>
+
+using bitcrusher::BoardState;
+using bitcrusher::Color;
+using bitcrusher::moveFromUci;
+using bitcrusher::parseFEN;
+using bitcrusher::heuristics::isLosingCapture;
+using bitcrusher::heuristics::staticExchangeEvaluation;
+
+namespace {
+
+int see(std::string_view fen, std::string_view move_uci) {
+    BoardState board;
+    parseFEN(fen, board);
+    const bitcrusher::Move move = moveFromUci(move_uci, board);
+    return board.isWhiteMove() ? staticExchangeEvaluation<Color::WHITE>(board, move)
+                               : staticExchangeEvaluation<Color::BLACK>(board, move);
+}
+
+} // namespace
+
+TEST(StaticExchangeTest, UndefendedPieceIsWon) {
+    EXPECT_EQ(see("4k3/8/8/3p4/4P3/8/8/4K3 w - - 0 1", "e4d5"), 100);
+}
+
+TEST(StaticExchangeTest, CapturingADefendedPawnWithARookLosesTheRook) {
+    EXPECT_EQ(see("4k3/8/2p5/3p4/8/8/8/3RK3 w - - 0 1", "d1d5"), 100 - 500);
+}
+
+TEST(StaticExchangeTest, XRayAttackerBehindTheCapturerJoinsTheExchange) {
+    // Black does not recapture on d5: the rook on d1 is behind the one on d2.
+    EXPECT_EQ(see("3rk3/8/8/3p4/8/8/3R4/3RK3 w - - 0 1", "d2d5"), 100);
+    // Without the second rook the black rook wins the exchange.
+    EXPECT_EQ(see("3rk3/8/8/3p4/8/8/3R4/4K3 w - - 0 1", "d2d5"), 100 - 500);
+}
+
+TEST(StaticExchangeTest, DefenderStopsWhenRecapturingLoses) {
+    // Knight takes a pawn defended by a queen, which would be lost to the pawn on e4.
+    EXPECT_EQ(see("4k3/8/4q3/3p4/4P3/2N5/8/4K3 w - - 0 1", "c3d5"), 100);
+}
+
+TEST(StaticExchangeTest, EnPassantCapturesThePawnBesideTheMover) {
+    EXPECT_EQ(see("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", "e5d6"), 100);
+}
+
+TEST(StaticExchangeTest, BlackCapturesAreScoredForBlack) {
+    EXPECT_EQ(see("4k3/8/8/3p4/4P3/8/8/4K3 b - - 0 1", "d5e4"), 100);
+}
+
+TEST(StaticExchangeTest, LosingCaptureCheck) {
+    BoardState board;
+    parseFEN("4k3/8/2p5/3p4/8/8/3Q4/3RK3 w - - 0 1", board);
+
+    EXPECT_TRUE(isLosingCapture<Color::WHITE>(board, moveFromUci("d2d5", board)));
+
+    parseFEN("4k3/8/8/3q4/4P3/8/8/4K3 w - - 0 1", board);
+    EXPECT_FALSE(isLosingCapture<Color::WHITE>(board, moveFromUci("e4d5", board)));
+}
@@ -0,0 +1,59 @@
+#include "search_manager.hpp"
+#include "thread_affinity.hpp"
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+using bitcrusher::interleaveNodes;
+using bitcrusher::parseCpuList;
+using bitcrusher::ThreadAffinity;
+using bitcrusher::ThreadBinding;
+
+TEST(ThreadAffinityTest, ParsesCpuLists) {
+    EXPECT_EQ(parseCpuList("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parseCpuList("5"), (std::vector<int>{5}));
+    EXPECT_EQ(parseCpuList(""), std::nullopt);
+    EXPECT_EQ(parseCpuList("3-1"), std::nullopt);
+    EXPECT_EQ(parseCpuList("0,,2"), std::nullopt);
+    EXPECT_EQ(parseCpuList("a-b"), std::nullopt);
+    EXPECT_EQ(parseCpuList("-1"), std::nullopt);
+}
+
+TEST(ThreadAffinityTest, InterleavesCpusOfEveryNode) {
+    const std::vector<std::vector<int>> nodes = {{0, 1, 2}, {32, 33}};
+    EXPECT_EQ(interleaveNodes(nodes), (std::vector<int>{0, 32, 1, 33, 2}));
+}
+
+// A list of one CPU the process may run on.
+static std::string firstProcessCpu() {
+    return std::to_string(bitcrusher::processCpus().front());
+}
+
+TEST(ThreadAffinityTest, ThreadsWrapAroundTheCpuList) {
+    const int                           cpu      = bitcrusher::processCpus().front();
+    const std::optional<ThreadAffinity> affinity = ThreadAffinity::cpuList(firstProcessCpu());
+    ASSERT_TRUE(affinity.has_value());
+    EXPECT_EQ(affinity->binding(), ThreadBinding::CPU_LIST);
+    EXPECT_EQ(affinity->cpuOf(0), cpu);
+    EXPECT_EQ(affinity->cpuOf(3), cpu);
+    EXPECT_EQ(ThreadAffinity::cpuList("100000"), std::nullopt);
+    EXPECT_EQ(ThreadAffinity{}.cpuOf(0), std::nullopt);
+}
+
+TEST(ThreadAffinityTest, BoundThreadsFindMateIn1) {
+    for (const ThreadAffinity& affinity :
+         {ThreadAffinity::numa(), *ThreadAffinity::cpuList(firstProcessCpu())}) {
+        bitcrusher::SearchManager search_manager{};
+        search_manager.setMaxCores(2);
+        search_manager.setThreadAffinity(affinity);
+        search_manager.setPos("1rb5/4r3/3p1npb/3kp1P1/1P3P1P/5nR1/2Q1BK2/bN4NR w - - 3 61");
+        bitcrusher::SearchParameters params;
+        params.max_ply = 3;
+
+        search_manager.startSearch<bitcrusher::FastMoveSink>(params);
+        search_manager.waitUntilSearchFinished();
+
+        EXPECT_EQ(search_manager.bestMoveUci(), "c2c4");
+    }
+}
@@ -0,0 +1,264 @@
+#include "bitboard_enums.hpp"
+#include "board_state.hpp"
+#include "constants.hpp"
+#include "fen_formatter.hpp"
+#include "move.hpp"
+#include "search_statistics.hpp"
+#include "transposition_table.hpp"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using bitcrusher::BoardState;
+using bitcrusher::CHECKMATE_BASE;
+using bitcrusher::INITIAL_POSITION_FEN;
+using bitcrusher::Move;
+using bitcrusher::moveFromUci;
+using bitcrusher::packMove;
+using bitcrusher::parseFEN;
+using bitcrusher::TranspositionTable;
+using bitcrusher::TranspositionTableEntry;
+using bitcrusher::TranspositionTableEvaluationType;
+using bitcrusher::TranspositionTableFileStatus;
+
+namespace {
+// Keys sharing the low bits land in the same bucket; the top 16 bits tell them apart.
+constexpr uint64_t bucketKey(uint64_t bucket, uint64_t tag) {
+    return (tag << 48) | bucket;
+}
+} // namespace
+
+class TranspositionTableTest : public ::testing::Test {
+protected:
+    void SetUp() override { tt.setSize(1024); }
+
+    TranspositionTable tt;
+};
+
+TEST_F(TranspositionTableTest, StoredEntryCanBeRetrieved) {
+    BoardState board;
+    parseFEN(INITIAL_POSITION_FEN, board);
+    const Move move = moveFromUci("e2e4", board);
+
+    tt.store(bucketKey(7, 1), 35, packMove(move), 6, TranspositionTableEvaluationType::LOWERBOUND,
+             0, 12);
+    const TranspositionTableEntry entry = tt.getEntry(bucketKey(7, 1), 0);
+
+    ASSERT_TRUE(entry.found());
+    EXPECT_EQ(entry.value, 35);
+    EXPECT_EQ(entry.depth, 6);
+    EXPECT_EQ(entry.static_eval, 12);
+    EXPECT_EQ(entry.evaluation_type, TranspositionTableEvaluationType::LOWERBOUND);
+    EXPECT_EQ(entry.best_move, packMove(move));
+}
+
+TEST_F(TranspositionTableTest, DifferentKeyInSameBucketIsAMiss) {
+    tt.store(bucketKey(7, 1), 35, 0, 6, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+
+    EXPECT_FALSE(tt.getEntry(bucketKey(7, 2), 0).found());
+}
+
+TEST_F(TranspositionTableTest, BucketKeepsSeveralPositions) {
+    for (uint64_t tag = 1; tag <= bitcrusher::TT_ENTRIES_PER_BUCKET; ++tag) {
+        tt.store(bucketKey(3, tag), static_cast<int>(tag), 0, 4,
+                 TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    }
+    for (uint64_t tag = 1; tag <= bitcrusher::TT_ENTRIES_PER_BUCKET; ++tag) {
+        const TranspositionTableEntry entry = tt.getEntry(bucketKey(3, tag), 0);
+        ASSERT_TRUE(entry.found());
+        EXPECT_EQ(entry.value, static_cast<int>(tag));
+    }
+}
+
+TEST_F(TranspositionTableTest, FullBucketReplacesShallowestEntry) {
+    for (uint64_t tag = 1; tag <= bitcrusher::TT_ENTRIES_PER_BUCKET; ++tag) {
+        tt.store(bucketKey(3, tag), 0, 0, static_cast<int>(tag) + 10,
+                 TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    }
+    tt.store(bucketKey(3, 100), 0, 0, 30, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+
+    EXPECT_FALSE(tt.getEntry(bucketKey(3, 1), 0).found()); // Shallowest was evicted.
+    EXPECT_TRUE(tt.getEntry(bucketKey(3, 2), 0).found());
+    EXPECT_TRUE(tt.getEntry(bucketKey(3, 100), 0).found());
+}
+
+TEST_F(TranspositionTableTest, EntriesSurviveNewSearch) {
+    tt.store(bucketKey(5, 1), 10, 0, 3, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    tt.newSearch();
+
+    EXPECT_TRUE(tt.getEntry(bucketKey(5, 1), 0).found());
+}
+
+TEST_F(TranspositionTableTest, FullBucketReplacesStaleEntriesFirst) {
+    // Deep entries from the previous search.
+    for (uint64_t tag = 1; tag < bitcrusher::TT_ENTRIES_PER_BUCKET; ++tag) {
+        tt.store(bucketKey(3, tag), 0, 0, 20, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    }
+    tt.newSearch();
+    tt.newSearch();
+    tt.newSearch();
+    // A shallower entry from the current search fills the last slot.
+    tt.store(bucketKey(3, 50), 0, 0, 10, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    tt.store(bucketKey(3, 100), 0, 0, 10, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+
+    EXPECT_TRUE(tt.getEntry(bucketKey(3, 50), 0).found());
+    EXPECT_TRUE(tt.getEntry(bucketKey(3, 100), 0).found());
+}
+
+TEST_F(TranspositionTableTest, MateScoresAreStoredRelativeToTheNode) {
+    // Mate found 5 plies below a node at ply 3, then probed from ply 7.
+    const int mate_score = CHECKMATE_BASE - 8;
+    tt.store(bucketKey(9, 1), mate_score, 0, 5, TranspositionTableEvaluationType::EXACT_VALUE, 3);
+
+    EXPECT_EQ(tt.getEntry(bucketKey(9, 1), 3).value, mate_score);
+    EXPECT_EQ(tt.getEntry(bucketKey(9, 1), 7).value, CHECKMATE_BASE - 12);
+}
+
+TEST_F(TranspositionTableTest, ClearRemovesAllEntries) {
+    tt.store(bucketKey(5, 1), 10, 0, 3, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    tt.clear();
+
+    EXPECT_FALSE(tt.getEntry(bucketKey(5, 1), 0).found());
+}
+
+// Runs every slice on a thread of its own, counting the slices.
+static bitcrusher::ParallelSlices sliceThreads(std::atomic<int>& slices_run) {
+    return [&slices_run](int slices, const std::function<void(int)>& task) {
+        std::vector<std::jthread> threads;
+        for (int slice = 0; slice < slices; ++slice) {
+            threads.emplace_back([&task, &slices_run, slice]() {
+                task(slice);
+                ++slices_run;
+            });
+        }
+    };
+}
+
+TEST_F(TranspositionTableTest, ClearWithSeveralThreadsRemovesAllEntries) {
+    for (uint64_t bucket = 0; bucket < 1024; bucket += 97) {
+        tt.store(bucketKey(bucket, 1), 10, 0, 3, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    }
+    std::atomic<int> slices_run{0};
+    tt.clear(4, sliceThreads(slices_run));
+    EXPECT_EQ(slices_run.load(), 4);
+
+    for (uint64_t bucket = 0; bucket < 1024; bucket += 97) {
+        EXPECT_FALSE(tt.getEntry(bucketKey(bucket, 1), 0).found());
+    }
+}
+
+TEST_F(TranspositionTableTest, ResizeWithSeveralThreadsStartsEmpty) {
+    tt.store(bucketKey(5, 1), 10, 0, 3, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    std::atomic<int> slices_run{0};
+    tt.setMBSize(4, 3, sliceThreads(slices_run));
+    EXPECT_EQ(slices_run.load(), 3);
+
+    EXPECT_EQ(tt.getEntryCount(), 4ULL * 1024 * 1024 / 64 * bitcrusher::TT_ENTRIES_PER_BUCKET);
+    EXPECT_FALSE(tt.getEntry(bucketKey(5, 1), 0).found());
+}
+
+TEST_F(TranspositionTableTest, ConcurrentStoresNeverReturnMixedEntries) {
+    // Few buckets and many writers, so threads keep overwriting each other's slots. Every entry
+    // stores its tag as both value and move; a hit pairing one with the other's write is torn.
+    tt.setSize(4);
+    constexpr int      THREADS    = 4;
+    constexpr uint64_t TAGS       = 500;
+    constexpr int      ITERATIONS = 20000;
+    std::atomic<int>   mixed{0};
+    {
+        std::vector<std::jthread> threads;
+        for (int thread = 0; thread < THREADS; ++thread) {
+            threads.emplace_back([&, thread]() {
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    const uint64_t tag = 1 + ((i * 7 + thread * 131) % TAGS);
+                    const uint64_t key = bucketKey(tag % 4, tag);
+                    tt.store(key, static_cast<int>(tag), static_cast<uint16_t>(tag),
+                             1 + (i % 20), TranspositionTableEvaluationType::EXACT_VALUE, 0);
+                    const TranspositionTableEntry entry = tt.getEntry(key, 0);
+                    if (entry.found() && entry.value != static_cast<int>(entry.best_move)) {
+                        mixed.fetch_add(1);
+                    }
+                }
+            });
+        }
+    }
+
+    EXPECT_EQ(mixed.load(), 0);
+}
+
+class TranspositionTableFileTest : public TranspositionTableTest {
+protected:
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::filesystem::path path =
+        std::filesystem::temp_directory_path() /
+        std::format("bitcrusher_tt_{}.bin", ::testing::UnitTest::GetInstance()->random_seed());
+};
+
+TEST_F(TranspositionTableFileTest, SavedTableCanBeLoaded) {
+    tt.store(bucketKey(7, 1), 35, 123, 6, TranspositionTableEvaluationType::LOWERBOUND, 0, 12);
+    ASSERT_EQ(tt.save(path, 12345), TranspositionTableFileStatus::OK);
+
+    TranspositionTable loaded;
+    ASSERT_EQ(loaded.load(path, 12345), TranspositionTableFileStatus::OK);
+
+    EXPECT_EQ(loaded.getEntryCount(), tt.getEntryCount());
+    const TranspositionTableEntry entry = loaded.getEntry(bucketKey(7, 1), 0);
+    ASSERT_TRUE(entry.found());
+    EXPECT_EQ(entry.value, 35);
+    EXPECT_EQ(entry.depth, 6);
+    EXPECT_EQ(entry.static_eval, 12);
+    EXPECT_EQ(entry.best_move, 123);
+}
+
+TEST_F(TranspositionTableFileTest, TableSavedWithAnotherSeedIsRejected) {
+    tt.store(bucketKey(7, 1), 35, 0, 6, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    ASSERT_EQ(tt.save(path, 1), TranspositionTableFileStatus::OK);
+
+    EXPECT_EQ(tt.load(path, 2), TranspositionTableFileStatus::INCOMPATIBLE);
+    EXPECT_TRUE(tt.getEntry(bucketKey(7, 1), 0).found()); // Left unchanged.
+}
+
+TEST_F(TranspositionTableFileTest, TruncatedFileIsRejected) {
+    ASSERT_EQ(tt.save(path, 12345), TranspositionTableFileStatus::OK);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    EXPECT_EQ(tt.load(path, 12345), TranspositionTableFileStatus::CORRUPTED);
+}
+
+TEST_F(TranspositionTableFileTest, MissingFileCannotBeOpened) {
+    EXPECT_EQ(tt.load(path, 12345), TranspositionTableFileStatus::CANNOT_OPEN);
+}
+
+TEST_F(TranspositionTableTest, HashfullCountsEntriesOfTheCurrentSearch) {
+    EXPECT_EQ(tt.hashfull(), 0);
+    for (uint64_t bucket = 0; bucket < 1000; ++bucket) {
+        tt.store(bucketKey(bucket, 1), 0, 0, 3, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    }
+
+    // One of six slots in each sampled bucket.
+    EXPECT_EQ(tt.hashfull(), 1000 / bitcrusher::TT_ENTRIES_PER_BUCKET);
+
+    tt.newSearch();
+    EXPECT_EQ(tt.hashfull(), 0);
+}
+
+TEST_F(TranspositionTableTest, ProbesAndStoresAreCountedPerThread) {
+    bitcrusher::thread_search_statistics = {};
+    for (uint64_t tag = 1; tag <= bitcrusher::TT_ENTRIES_PER_BUCKET + 1; ++tag) {
+        tt.store(bucketKey(3, tag), 0, 0, 4, TranspositionTableEvaluationType::EXACT_VALUE, 0);
+    }
+    static_cast<void>(tt.getEntry(bucketKey(3, 2), 0));
+    static_cast<void>(tt.getEntry(bucketKey(4, 1), 0));
+
+    const bitcrusher::SearchStatistics stats = bitcrusher::thread_search_statistics;
+    EXPECT_EQ(stats.tt_stores, bitcrusher::TT_ENTRIES_PER_BUCKET + 1);
+    EXPECT_EQ(stats.tt_replacements, 1); // The seventh position evicted one of the first six.
+    EXPECT_EQ(stats.tt_probes, 2);
+    EXPECT_EQ(stats.tt_hits, 1);
+}
@@ -3,6 +3,7 @@
 #include <pybind11/stl.h> // NOLINT(misc-include-cleaner)
 
 #include <cstdint>
+#include <filesystem>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -84,13 +85,17 @@ static int bcEvaluate(const std::string& fen) {
 }
 
 // ---------------------------------------------------------------------------
-// search(fen, depth, time_limit_ms) -> dict
+// search(fen, depth, time_limit_ms, hash_file) -> dict
 //   Keys: score_cp (int|None), score_mate (int|None), best_move (str),
 //         pv (list[str]), nodes (int)
+//   hash_file: optional saved transposition table, loaded before the search
+//              when it exists and written back after it.
 // ---------------------------------------------------------------------------
 
-static py::dict
-bcSearch(const std::string& fen, int depth, int time_limit_ms = DEFAULT_TIME_LIMIT_MS) {
+static py::dict bcSearch(const std::string& fen,
+                         int                depth,
+                         int                time_limit_ms = DEFAULT_TIME_LIMIT_MS,
+                         const std::string& hash_file     = "") {
     using bitcrusher::FastMoveSink;
     using bitcrusher::SearchManager;
     using bitcrusher::SearchParameters;
@@ -102,26 +107,35 @@ bcSearch(const std::string& fen, int depth, int time_limit_ms = DEFAULT_TIME_LIM
         throw std::invalid_argument("time_limit_ms must be non-negative");
     }
 
+    // Its search threads come from the process-wide pool, started by the first call.
     SearchManager manager;
     manager.setPos(fen);
 
     SearchParameters params;
-    // UCI "go depth N" maps to max_ply = N * 2 (iterative deepening steps).
-    params.max_ply = depth * 2;
+    // Depth in plies, the same unit as UCI "go depth N".
+    params.max_ply = depth;
     // Prevent unbounded search when no time controls are set - calculateMoveTimeAllocation
     // returns INT_MAX when all time fields are zero, which effectively never terminates.
     params.move_time_ms = time_limit_ms > 0 ? time_limit_ms : DEFAULT_TIME_LIMIT_MS;
 
     {
         const py::gil_scoped_release release;
+        if (! hash_file.empty() && std::filesystem::exists(hash_file)) {
+            // A stale or incompatible file is ignored, the search then starts from an empty table.
+            static_cast<void>(manager.loadHash(hash_file));
+        }
         manager.startSearch<FastMoveSink>(params);
         manager.waitUntilSearchFinished();
+        if (! hash_file.empty()) {
+            // Also waits for helper threads still returning from the search.
+            static_cast<void>(manager.saveHash(hash_file));
+        }
     }
 
     const std::string best_move = manager.bestMoveUci();
     const std::string score_str = manager.getScore(); // "cp X" or "mate X"
     const uint64_t    nodes     = manager.getNodeCount();
-    const std::string pv_str    = manager.getPrincipalVariation(depth);
+    const std::string pv_str    = manager.getPrincipalVariation();
 
     // Split PV string into individual move tokens.
     std::vector<std::string> pv;
@@ -166,8 +180,10 @@ PYBIND11_MODULE(chess_engine, m) {
           "Positive = side to move is winning.");
 
     m.def("search", &bcSearch, py::arg("fen"), py::arg("depth") = 12,
-          py::arg("time_limit_ms") = DEFAULT_TIME_LIMIT_MS,
+          py::arg("time_limit_ms") = DEFAULT_TIME_LIMIT_MS, py::arg("hash_file") = "",
           "Run iterative-deepening alpha-beta search. "
+          "If hash_file is set, the transposition table is loaded from it when present "
+          "and saved to it afterwards. "
           "Returns a dict: {score_cp, score_mate, best_move, pv, nodes}.");
 }
 